@@ -0,0 +1,139 @@
+/**
+  ******************************************************************************
+  * @file	: 01_DbncdMPBttn_2a.ino
+  * @brief  : Example for the ButtonToSwitch_AVR library DbncdMPBttn class release debounce
+  *
+  * Repository: https://github.com/GabyGold67/ButtonToSwitch_AVR
+  *
+  *   Framework: Arduino
+  *   Platform: *
+  *
+  * @details The example needs no hardware but the serial monitor: a simulated
+  * noisy MPB signal is generated by software and fed through an input function
+  * to two DbncdMPBttn objects:
+  * 	- rawRlsBttn keeps the default release debounce time of 0 ms, so the
+  *     release is validated with no debounce time.
+  * 	- dbncdRlsBttn has the release debounce set in auto mode, following the
+  *     press debounce time.
+  *
+  * Every simulated press cycle lasts 1500 ms: the MPB is kept pressed 600 ms
+  * with a short contact dropout every 100 ms -noisy cabling-, then released
+  * with 40 ms of contact bounces. A clean MPB would produce exactly one
+  * turn On and one turn Off every cycle.
+  *
+  * At the end of every cycle the number of times each object was turned On
+  * during the cycle is printed: the rawRlsBttn object shows the spurious
+  * release/press cycles caused by the dropouts, while the dbncdRlsBttn object
+  * must show exactly one, otherwise a FAIL message is printed.
+  *
+  * @author	: Gabriel D. Goldman
+  * mail <gdgoldman67@hotmail.com>
+  * Github <https://github.com/GabyGold67>
+  *
+  * @date First release: 18/10/2026
+  *       Last update:   18/10/2026 12:00 GMT+0200 DST
+  ******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+  *
+  * @warning The use of this library falls in the category described by The Alan
+  * Parsons Project (c) 1980 "Games People play" disclaimer:
+  * Games people play, you take it or you leave it
+  * Things that they say aren't alright
+  * If I promised you the moon and the stars, would you believe it?
+  *
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+*/
+
+#include <Arduino.h>
+#include <ButtonToSwitch.h>
+
+const unsigned long int cyclePrd{1500};  // Simulated press cycle period
+const unsigned long int prssTm{600};     // Time the MPB is kept pressed every cycle
+const unsigned long int drpPrd{100};     // Period of the contact dropouts while pressed
+const unsigned long int drpTm{12};       // Length of each contact dropout
+const unsigned long int bncTm{40};       // Length of the release contact bounces
+const unsigned long int bncSgmnt{12};    // Length of each open or closed segment of the release bounces
+
+bool noisyMpbLvl(void* argPtr);
+void rawRlsTrnOn();
+void dbncdRlsTrnOn();
+
+DbncdMPBttn rawRlsBttn (2);  // The pins are not read, the input functions replace them
+DbncdMPBttn dbncdRlsBttn (3);
+
+volatile uint8_t rawRlsOnCnt{0};
+volatile uint8_t dbncdRlsOnCnt{0};
+unsigned long int cycleStrt{0};
+unsigned long int cycleNum{0};
+
+void setup() {
+  Serial.begin(9600);
+
+  rawRlsBttn.setInptFnc(noisyMpbLvl, &cycleStrt);
+  rawRlsBttn.setDbncTime(30);
+  rawRlsBttn.setFnWhnTrnOnPtr(rawRlsTrnOn);
+
+  dbncdRlsBttn.setInptFnc(noisyMpbLvl, &cycleStrt);
+  dbncdRlsBttn.setDbncTime(30);
+  dbncdRlsBttn.setDbncRlsAuto(true); // The release must be stable for 30 ms too
+  dbncdRlsBttn.setFnWhnTrnOnPtr(dbncdRlsTrnOn);
+
+  cycleStrt = millis();
+  rawRlsBttn.begin(5);
+  dbncdRlsBttn.begin(5);
+}
+
+void loop() {
+  uint8_t rawCnt{0};
+  uint8_t dbncdCnt{0};
+
+  if((millis() - cycleStrt) >= cyclePrd){
+    noInterrupts();
+    rawCnt = rawRlsOnCnt;
+    dbncdCnt = dbncdRlsOnCnt;
+    rawRlsOnCnt = 0;
+    dbncdRlsOnCnt = 0;
+    cycleStrt += cyclePrd;
+    interrupts();
+
+    Serial.print("Cycle ");
+    Serial.print(++cycleNum);
+    Serial.print(" - Turned On: no release debounce ");
+    Serial.print(rawCnt);
+    Serial.print(" times, release debounce ");
+    Serial.print(dbncdCnt);
+    Serial.print(" times");
+    if(dbncdCnt != 1)
+      Serial.println(" - FAIL");
+    else
+      Serial.println(" - OK");
+  }
+}
+
+bool noisyMpbLvl(void* argPtr){
+  // Simulated pulled up MPB: LOW when pressed, HIGH when released
+  unsigned long int cycleTm{millis() - *((unsigned long int*)argPtr)};
+  bool result{HIGH};
+
+  if(cycleTm < cyclePrd){
+    if(cycleTm < prssTm){
+      if((cycleTm % drpPrd) < (drpPrd - drpTm))
+        result = LOW;  // Pressed, but for the dropouts
+    }
+    else if(cycleTm < (prssTm + bncTm)){
+      if(((cycleTm - prssTm) / bncSgmnt) % 2)
+        result = LOW;  // Bouncing closed contact
+    }
+  }
+
+  return result;
+}
+
+void rawRlsTrnOn(){
+  rawRlsOnCnt = rawRlsOnCnt + 1;
+}
+
+void dbncdRlsTrnOn(){
+  dbncdRlsOnCnt = dbncdRlsOnCnt + 1;
+}
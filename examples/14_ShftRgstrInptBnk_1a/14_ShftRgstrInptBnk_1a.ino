@@ -0,0 +1,81 @@
+/**
+  ******************************************************************************
+  * @file	: 14_ShftRgstrInptBnk_1a.ino
+  * @brief  : Example for the ButtonToSwitch_AVR library ShftRgstrInptBnk class
+  *
+  * Repository: https://github.com/GabyGold67/ButtonToSwitch_AVR
+  * 
+  *   Framework: Arduino
+  *   Platform: *
+  * 
+  * @details The example instantiates a ShftRgstrInptBnk object using:
+  * 	- 2 74HC165 shift registers chained, with their parallel load inputs connected
+  * 	to hc165LdPin, their clock inputs connected to hc165ClkPin, and the serial output
+  * 	of the first one connected to hc165DataPin
+  * 	- 16 push buttons between GND and each of the parallel inputs, each input with
+  * 	it's own pull-up resistor
+  * 	- 1 led with it's corresponding resistor between GND and tgglIsOnOtpt
+  * 	- 1 led with it's corresponding resistor between GND and dmpbIsOnOtpt
+  *
+  * The whole chain is read once every timer interrupt, and the input levels are
+  * provided to a TgglLtchMPBttn object (input 0) and a DbncdMPBttn object (input 9)
+  * 
+  * When a change in the object's outputs attribute flags values is detected, it
+  * manages the loads and resources that the switch turns On and Off, in this
+  * example case are the output of some GPIO pins.
+  *
+  * @author	: Gabriel D. Goldman
+  * mail <gdgoldman67@hotmail.com>
+  * Github <https://github.com/GabyGold67>
+  *
+  * @date First release: 18/10/2026 
+  *       Last update:   18/10/2026 12:00 GMT+0200 DST
+  ******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+  * 
+  * @warning The use of this library falls in the category described by The Alan 
+  * Parsons Project (c) 1980 "Games People play" disclaimer:  
+  * Games people play, you take it or you leave it  
+  * Things that they say aren't alright  
+  * If I promised you the moon and the stars, would you believe it?  
+  * 
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+*/
+
+#include <Arduino.h>
+#include <ButtonToSwitch.h>
+
+const uint8_t hc165LdPin{8};
+const uint8_t hc165ClkPin{9};
+const uint8_t hc165DataPin{10};
+const uint8_t tgglIsOnOtpt{3};
+const uint8_t dmpbIsOnOtpt{4};
+
+ShftRgstrInptBnk myInptBnk (hc165LdPin, hc165ClkPin, hc165DataPin, 2);
+TgglLtchMPBttn myTgglBttn (0);  // The "pin" parameter is the input index in the shift registers chain
+DbncdMPBttn myDMPBttn (9);
+
+void setup() {
+  digitalWrite(tgglIsOnOtpt, LOW);
+  pinMode(tgglIsOnOtpt, OUTPUT);
+  digitalWrite(dmpbIsOnOtpt, LOW);
+  pinMode(dmpbIsOnOtpt, OUTPUT);
+
+  myInptBnk.begin();  // The bank must be started before the objects using it
+  myTgglBttn.setInptPrvdr(&myInptBnk);
+  myDMPBttn.setInptPrvdr(&myInptBnk);
+  myTgglBttn.begin(20);
+  myDMPBttn.begin(20);
+}
+
+void loop() {
+  if(myTgglBttn.getOutputsChange()){
+    digitalWrite(tgglIsOnOtpt, (myTgglBttn.getIsOn())?HIGH:LOW);    
+    myTgglBttn.setOutputsChange(false);
+  }
+  if(myDMPBttn.getOutputsChange()){
+    digitalWrite(dmpbIsOnOtpt, (myDMPBttn.getIsOn())?HIGH:LOW);    
+    myDMPBttn.setOutputsChange(false);
+  }
+}
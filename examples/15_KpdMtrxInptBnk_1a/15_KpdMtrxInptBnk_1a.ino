@@ -0,0 +1,93 @@
+/**
+  ******************************************************************************
+  * @file	: 15_KpdMtrxInptBnk_1a.ino
+  * @brief  : Example for the ButtonToSwitch_AVR library KpdMtrxInptBnk class
+  *
+  * Repository: https://github.com/GabyGold67/ButtonToSwitch_AVR
+  * 
+  *   Framework: Arduino
+  *   Platform: *
+  * 
+  * @details The example instantiates a KpdMtrxInptBnk object using:
+  * 	- 1 4x4 keypad matrix with it's rows connected to kpdRowPins and it's columns
+  * 	connected to kpdColPins
+  * 	- 1 led with it's corresponding resistor between GND and tgglIsOnOtpt
+  * 	- 1 led with it's corresponding resistor between GND and tmLtchIsOnOtpt
+  * 	- 1 led with it's corresponding resistor between GND and tmVdblIsOnOtpt
+  *
+  * The keypad is scanned one row every timer interrupt, and three of it's keys
+  * are bound to switch objects: key 0 as a toggle switch, key 5 as a timer latched
+  * switch and key 15 as a time voidable switch. The rest of the keys debounced
+  * levels are read through the keypad object.
+  * 
+  * When a change in the object's outputs attribute flags values is detected, it
+  * manages the loads and resources that the switch turns On and Off, in this
+  * example case are the output of some GPIO pins.
+  *
+  * @author	: Gabriel D. Goldman
+  * mail <gdgoldman67@hotmail.com>
+  * Github <https://github.com/GabyGold67>
+  *
+  * @date First release: 18/10/2026 
+  *       Last update:   18/10/2026 12:00 GMT+0200 DST
+  ******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+  * 
+  * @warning The use of this library falls in the category described by The Alan 
+  * Parsons Project (c) 1980 "Games People play" disclaimer:  
+  * Games people play, you take it or you leave it  
+  * Things that they say aren't alright  
+  * If I promised you the moon and the stars, would you believe it?  
+  * 
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+*/
+
+#include <Arduino.h>
+#include <ButtonToSwitch.h>
+
+const uint8_t kpdRowPins[4]{4, 5, 6, 7};
+const uint8_t kpdColPins[4]{8, 9, 10, 11};
+const uint8_t tgglIsOnOtpt{A1};
+const uint8_t tmLtchIsOnOtpt{A2};
+const uint8_t tmVdblIsOnOtpt{A3};
+
+KpdMtrxInptBnk myKpd (kpdRowPins, 4, kpdColPins, 4);
+TgglLtchMPBttn myTgglBttn (0);  // The "pin" parameter is the key index in the keypad: (row * 4) + column
+TmLtchMPBttn myTmLtchBttn (5, 3000);
+TmVdblMPBttn myTmVdblBttn (15, 2000);
+
+void setup() {
+  digitalWrite(tgglIsOnOtpt, LOW);
+  pinMode(tgglIsOnOtpt, OUTPUT);
+  digitalWrite(tmLtchIsOnOtpt, LOW);
+  pinMode(tmLtchIsOnOtpt, OUTPUT);
+  digitalWrite(tmVdblIsOnOtpt, LOW);
+  pinMode(tmVdblIsOnOtpt, OUTPUT);
+  Serial.begin(9600);
+
+  myKpd.begin();  // The keypad must be started before the objects using it
+  myTgglBttn.setInptPrvdr(&myKpd);
+  myTmLtchBttn.setInptPrvdr(&myKpd);
+  myTmVdblBttn.setInptPrvdr(&myKpd);
+  myTgglBttn.begin(5);
+  myTmLtchBttn.begin(5);
+  myTmVdblBttn.begin(5);
+}
+
+void loop() {
+  if(myTgglBttn.getOutputsChange()){
+    digitalWrite(tgglIsOnOtpt, (myTgglBttn.getIsOn())?HIGH:LOW);    
+    myTgglBttn.setOutputsChange(false);
+  }
+  if(myTmLtchBttn.getOutputsChange()){
+    digitalWrite(tmLtchIsOnOtpt, (myTmLtchBttn.getIsOn())?HIGH:LOW);    
+    myTmLtchBttn.setOutputsChange(false);
+  }
+  if(myTmVdblBttn.getOutputsChange()){
+    digitalWrite(tmVdblIsOnOtpt, (myTmVdblBttn.getIsOn())?HIGH:LOW);    
+    myTmVdblBttn.setOutputsChange(false);
+  }
+  if(myKpd.getKyPrssd(1))
+    Serial.println("Key 1 pressed");
+}
@@ -0,0 +1,89 @@
+/**
+  ******************************************************************************
+  * @file	: 16_AnlgLddrInptBnk_1a.ino
+  * @brief  : Example for the ButtonToSwitch_AVR library AnlgLddrInptBnk class
+  *
+  * Repository: https://github.com/GabyGold67/ButtonToSwitch_AVR
+  * 
+  *   Framework: Arduino
+  *   Platform: *
+  * 
+  * @details The example instantiates an AnlgLddrInptBnk object using:
+  * 	- 5 push buttons connected to the lddrAnlgPin analog input through a resistor
+  * 	ladder, with a pull-up resistor to Vcc
+  * 	- 1 led with it's corresponding resistor between GND and tgglIsOnOtpt
+  * 	- 1 led with it's corresponding resistor between GND and dmpbIsOnOtpt
+  *
+  * One conversion is done every timer interrupt, and the converted value is
+  * classified by the calibrated windows into a button index. Button 0 is used
+  * as a toggle switch and button 3 as a debounced momentary switch. The converted
+  * value is printed to help calibrating the windows for a different ladder.
+  * 
+  * When a change in the object's outputs attribute flags values is detected, it
+  * manages the loads and resources that the switch turns On and Off, in this
+  * example case are the output of some GPIO pins.
+  *
+  * @author	: Gabriel D. Goldman
+  * mail <gdgoldman67@hotmail.com>
+  * Github <https://github.com/GabyGold67>
+  *
+  * @date First release: 18/10/2026 
+  *       Last update:   18/10/2026 12:00 GMT+0200 DST
+  ******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+  * 
+  * @warning The use of this library falls in the category described by The Alan 
+  * Parsons Project (c) 1980 "Games People play" disclaimer:  
+  * Games people play, you take it or you leave it  
+  * Things that they say aren't alright  
+  * If I promised you the moon and the stars, would you believe it?  
+  * 
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+*/
+
+#include <Arduino.h>
+#include <ButtonToSwitch.h>
+
+const uint8_t lddrAnlgPin{A0};
+const uint8_t tgglIsOnOtpt{3};
+const uint8_t dmpbIsOnOtpt{4};
+const uint16_t lddrWndws[10]{0, 50, 100, 180, 280, 380, 450, 560, 650, 780};  // {btn0Min, btn0Max, btn1Min, btn1Max, ...}
+
+AnlgLddrInptBnk myLddrBnk (lddrAnlgPin, lddrWndws, 5);
+TgglLtchMPBttn myTgglBttn (0);  // The "pin" parameter is the button index in the ladder
+DbncdMPBttn myDMPBttn (3);
+
+void setup() {
+  digitalWrite(tgglIsOnOtpt, LOW);
+  pinMode(tgglIsOnOtpt, OUTPUT);
+  digitalWrite(dmpbIsOnOtpt, LOW);
+  pinMode(dmpbIsOnOtpt, OUTPUT);
+  Serial.begin(9600);
+
+  myLddrBnk.begin();  // The bank must be started before the objects using it
+  myTgglBttn.setInptPrvdr(&myLddrBnk);
+  myDMPBttn.setInptPrvdr(&myLddrBnk);
+  myTgglBttn.begin(10);
+  myDMPBttn.begin(10);
+}
+
+void loop() {
+  static uint8_t lstBttnId{0xFF};
+
+  if(myTgglBttn.getOutputsChange()){
+    digitalWrite(tgglIsOnOtpt, (myTgglBttn.getIsOn())?HIGH:LOW);    
+    myTgglBttn.setOutputsChange(false);
+  }
+  if(myDMPBttn.getOutputsChange()){
+    digitalWrite(dmpbIsOnOtpt, (myDMPBttn.getIsOn())?HIGH:LOW);    
+    myDMPBttn.setOutputsChange(false);
+  }
+  if(myLddrBnk.getCurBttnId() != lstBttnId){
+    lstBttnId = myLddrBnk.getCurBttnId();
+    Serial.print("Converted value: ");
+    Serial.print(myLddrBnk.getAdcVal());
+    Serial.print(" Button index: ");
+    Serial.println(lstBttnId);
+  }
+}
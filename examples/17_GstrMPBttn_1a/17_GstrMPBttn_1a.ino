@@ -0,0 +1,89 @@
+/**
+  ******************************************************************************
+  * @file	: 17_GstrMPBttn_1a.ino
+  * @brief  : Example for the ButtonToSwitch_AVR library GstrMPBttn class
+  *
+  * Repository: https://github.com/GabyGold67/ButtonToSwitch_AVR
+  * 
+  *   Framework: Arduino
+  *   Platform: *
+  * 
+  * @details The example instantiates a GstrMPBttn object using:
+  * 	- 1 push button between GND and gstrSwitchpin
+  * 	- 1 led with it's corresponding resistor between GND and isOnOtpt
+  * 	- 1 led with it's corresponding resistor between GND and lngPrssOtpt
+  *
+  * The isOnOtpt led follows the MPB pressed state, as a DD-MPB does. Each
+  * recognized gesture is printed: single, double and triple clicks, long press
+  * and the accelerated hold repeats of a long press kept pressed. The
+  * lngPrssOtpt led is toggled by every long press gesture.
+  * 
+  * When a change in the object's outputs attribute flags values is detected, it
+  * manages the loads and resources that the switch turns On and Off, in this
+  * example case are the output of some GPIO pins.
+  *
+  * @author	: Gabriel D. Goldman
+  * mail <gdgoldman67@hotmail.com>
+  * Github <https://github.com/GabyGold67>
+  *
+  * @date First release: 18/10/2026 
+  *       Last update:   18/10/2026 12:00 GMT+0200 DST
+  ******************************************************************************
+  * @warning **Use of this library is under your own responsibility**
+  * 
+  * @warning The use of this library falls in the category described by The Alan 
+  * Parsons Project (c) 1980 "Games People play" disclaimer:  
+  * Games people play, you take it or you leave it  
+  * Things that they say aren't alright  
+  * If I promised you the moon and the stars, would you believe it?  
+  * 
+  * Released into the public domain in accordance with "GPL-3.0-or-later" license terms.
+  ******************************************************************************
+*/
+
+#include <Arduino.h>
+#include <ButtonToSwitch.h>
+
+const uint8_t gstrSwitchpin{2};
+const uint8_t isOnOtpt{3};
+const uint8_t lngPrssOtpt{4};
+
+GstrMPBttn myGstrBttn (gstrSwitchpin);
+
+void setup() {
+  digitalWrite(isOnOtpt, LOW);
+  pinMode(isOnOtpt, OUTPUT);
+  digitalWrite(lngPrssOtpt, LOW);
+  pinMode(lngPrssOtpt, OUTPUT);
+  Serial.begin(9600);
+
+  myGstrBttn.setClckWndw(300);
+  myGstrBttn.setLngPrssTm(1000);
+  myGstrBttn.setHldRpt(500, 400, 50, 20); // First repeat 500 ms after the long press, then every 400 ms accelerating a 20% each time down to 50 ms
+  myGstrBttn.begin(10);
+}
+
+void loop() {
+  uint8_t gstr{GstrNone};
+
+  if(myGstrBttn.getOutputsChange()){
+    digitalWrite(isOnOtpt, (myGstrBttn.getIsOn())?HIGH:LOW);
+    gstr = myGstrBttn.getGstr();
+    if(gstr != GstrNone){
+      if(gstr == GstrClck){
+        Serial.print("Clicks: ");
+        Serial.println(myGstrBttn.getGstrCnt());
+      }
+      else if(gstr == GstrLngPrss){
+        Serial.println("Long press");
+        digitalWrite(lngPrssOtpt, (digitalRead(lngPrssOtpt) == HIGH)?LOW:HIGH);
+      }
+      else if(gstr == GstrHldRpt){
+        Serial.print("Hold repeat: ");
+        Serial.println(myGstrBttn.getGstrCnt());
+      }
+      myGstrBttn.clrGstr();
+    }
+    myGstrBttn.setOutputsChange(false);
+  }
+}
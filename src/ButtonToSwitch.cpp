@@ -45,14 +45,90 @@
   * If I promised you the moon and the stars, would you believe it?  
  *******************************************************************************
  */
+#if defined(_MpbHostBuild)	// Host builds over a simulated Arduino API layer, see DbncdMPBttn::waitForChange(). Included before Arduino.h, as it's min() and max() macros break the standard headers
+	#include <condition_variable>
+	#include <mutex>
+#endif
 #include <Arduino.h>
 #include <ButtonToSwitch.h>
 #include <TimerOne.h>
+#if defined(__AVR__)
+	#include <avr/eeprom.h>
+	#include <avr/sleep.h>
+#endif
+#if defined(__has_include)
+	#if __has_include(<SPI.h>)	// The SPI library is available to the build only when the sketch includes it
+		#include <SPI.h>
+		#define _MpbHwSpiAvlbl
+	#endif
+	#if !defined(__AVR__)
+		#if __has_include(<EEPROM.h>)	// The AVR platforms use the avr-libc EEPROM functions, the rest the EEPROM library when the sketch includes it
+			#include <EEPROM.h>
+			#define _MpbEepromLibAvlbl
+			#if defined(ARDUINO_ARCH_ESP8266) || defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_RP2040)
+				#define _MpbEepromCmmtNdd	// The EEPROM is emulated in a RAM buffer: it must be sized by EEPROM.begin(), and saved to flash by EEPROM.commit()
+			#endif
+		#endif
+	#endif
+#endif
 //===========================>> BEGIN General use Global variables
+#if defined(_MpbHostBuild)
+static std::mutex _mpbHstWaitMtx;	// Host builds: waitForChange() blocks on the condition variable, notified by every timer interrupt service execution
+static std::condition_variable _mpbHstWaitCv;
+#endif
 //===========================>> END General use Global variables
 
+//===========================>> BEGIN General use macros
+// Critical section delimiters for the data shared with the timer interrupt service. Both versions restore the previous interrupts state instead of unconditionally enabling them, so they are safe to use from the timer interrupt service itself (i.e. _turnOn() and _turnOff() executed by the FSMs) and when interrupts are not yet enabled (i.e. global objects construction) 
+#if defined(__AVR__)
+	#define _MpbCrtclSctnBgn() uint8_t _mpbSregSv {SREG}; cli()
+	#define _MpbCrtclSctnEnd() SREG = _mpbSregSv
+#elif defined(__arm__)	// ARM Cortex-M cores (i.e. Teensy 3.x/4.x, the other platform supported by TimerOne): save and restore the PRIMASK register
+	#define _MpbCrtclSctnBgn() uint32_t _mpbPrmskSv; __asm__ volatile("mrs %0, primask" : "=r" (_mpbPrmskSv) :: "memory"); __asm__ volatile("cpsid i" ::: "memory")
+	#define _MpbCrtclSctnEnd() __asm__ volatile("msr primask, %0" :: "r" (_mpbPrmskSv) : "memory")
+#else	// Other cores (i.e. the ESP32 TimerOne forks): no portable way to read the interrupts state, a nesting depth counter keeps the inner critical sections, and the ones executed by the timer interrupt service, from enabling the interrupts. Only the outermost critical section executed from the main code enables them when ended
+	#define _MpbCrtclSctnDpthUsd
+	static volatile uint8_t _mpbCrtclSctnDpth{0};
+	static inline void _mpbCrtclSctnEndFn(){
+		_mpbCrtclSctnDpth = _mpbCrtclSctnDpth - 1;
+		if(_mpbCrtclSctnDpth == 0)
+			interrupts();
+
+		return;
+	}
+	#define _MpbCrtclSctnBgn() noInterrupts(); _mpbCrtclSctnDpth = _mpbCrtclSctnDpth + 1
+	#define _MpbCrtclSctnEnd() _mpbCrtclSctnEndFn()
+#endif
+//===========================>> END General use macros
+
+//===========================>> BEGIN General use functions
+// Configuration records little endian values writing and reading, the buffer pointer is advanced past the value
+static void _cfgWrt(uint8_t* &bufPtr, const uint32_t &val, const uint8_t &bytesQty){
+	for(uint8_t i{0}; i < bytesQty; ++i)
+		*(bufPtr++) = (uint8_t)(val >> (i * 8));
+
+	return;
+}
+
+static uint32_t _cfgRd(const uint8_t* &bufPtr, const uint8_t &bytesQty){
+	uint32_t result{0};
+
+	for(uint8_t i{0}; i < bytesQty; ++i)
+		result |= ((uint32_t)*(bufPtr++)) << (i * 8);
+
+	return result;
+}
+//===========================>> END General use functions
+
 //===========================>> BEGIN Base Class Static variables initialization
+volatile uint32_t DbncdMPBttn::_drtyMsk[_DrtyMpbsMax / 32] = {0};	// "Dirty objects" bitmap, bit n corresponds to the object in the position n of the "MPBs to be updated list"
 DbncdMPBttn** DbncdMPBttn::_mpbsInstncsLstPtr = nullptr;	// Pointer to the array of pointers of DbncdMPBttn objects whose state must be kept updated by the Timer
+unsigned long int* DbncdMPBttn::_actvPrdsLstPtr = nullptr;	// Sorted list of the distinct poll periods of the timer attached MPBs
+uint16_t* DbncdMPBttn::_actvPrdsCntLstPtr = nullptr;	// Quantity of timer attached MPBs using each of the _actvPrdsLstPtr listed poll periods
+unsigned long int DbncdMPBttn::_actvPrdsMCD = 0;	// MCD of the _actvPrdsLstPtr listed poll periods, 0 if the list is empty
+uint8_t DbncdMPBttn::_actvPrdsQty = 0;	// Quantity of distinct poll periods in the _actvPrdsLstPtr list
+DbncdMPBttn::mpbTmr_t* DbncdMPBttn::_tmrsLstHd = nullptr;	// Head of the soft-timers list, the armed timers sorted by deadline, earliest first
+volatile uint32_t DbncdMPBttn::_sttsGnrtn = 1;	// Status generation number, incremented every time an object's outputsChange flag is set. Starts at 1 as the 0 value is reserved to mean "all the generations"
 unsigned long int DbncdMPBttn::_updTimerPeriod = 0;	// Time period for the update Timer to be executed. As is only ONE timer for all the DbncdMPBttn objects, the time period must be shared, so a MCD calculation will determine the value to be used for resources use optimization. The non-valid 0 value will be used as a flag to signal the service is not active, activation must be done after setting the new operations value.
 //===========================>> END Base Class Static variables initialization
 
@@ -69,7 +145,14 @@ void DbncdMPBttn::_ISRMpbsRfrshCb(){
 	int auxPtr{0};
 	unsigned long int curTime{millis()};
 
+#if defined(_MpbCrtclSctnDpthUsd)
+	_mpbCrtclSctnDpth = _mpbCrtclSctnDpth + 1;	// The critical sections executed by the service must not enable the interrupts
+#endif
 	if(_mpbsInstncsLstPtr != nullptr){
+		if(MpbInptPrvdr::_snpshtUpdLstPtr != nullptr)	// Input providers snapshots are taken once, before any MPB is updated
+			MpbInptPrvdr::_updSnpshts();
+		if(_tmrsLstHd != nullptr)	// Soft-timers deadlines are checked once, before any MPB is updated
+			_srvcTmrs(curTime);
 		while (*(_mpbsInstncsLstPtr + auxPtr) != nullptr){
 			if((*(_mpbsInstncsLstPtr + auxPtr))->getUpdTmrAttchd()){	// The MPB is attached to the update service, check if update time reached
 				if((curTime - ((*(_mpbsInstncsLstPtr + auxPtr))->getLstPollTime())) >= ((*(_mpbsInstncsLstPtr + auxPtr))->getPollPeriodMs())){
@@ -79,6 +162,8 @@ void DbncdMPBttn::_ISRMpbsRfrshCb(){
 			}
 			++auxPtr;
 		}
+		if(ShftRgstrOtptBnk::_otptsUpdLstPtr != nullptr)	// Output banks are written once, after every MPB was updated
+			ShftRgstrOtptBnk::_updOtptsBnks();
 		if(auxPtr == 0){//! The _mpbsInstncsLstPtr IS pointing to an empty "list of MPBtns to be updated", the list must be deleted and the _mpbsInstncsLstPtr -> nullptr			
 			Timer1.stop();
 			Timer1.detachInterrupt();
@@ -91,9 +176,473 @@ void DbncdMPBttn::_ISRMpbsRfrshCb(){
 		Timer1.stop();
 		Timer1.detachInterrupt();
 	}
+#if defined(_MpbCrtclSctnDpthUsd)
+	_mpbCrtclSctnDpth = _mpbCrtclSctnDpth - 1;
+#endif
+#if defined(_MpbHostBuild)
+	{	// The simulated clock advanced and the dirty objects bitmap might have changed: the waiting thread checks again. Locking the mutex keeps the notification from being lost between it's check and it's wait
+		std::lock_guard<std::mutex> hstLck(_mpbHstWaitMtx);
+	}
+	_mpbHstWaitCv.notify_all();
+#endif
 
 	return;	
 }
+
+void DbncdMPBttn::_addActvPrd(const unsigned long int &prd){
+	/*Adds a poll period to the sorted list of distinct active poll periods, or increments it's
+	count if already listed. The MCD is updated incrementally, no list traversal needed*/
+	uint8_t lwIdx{0};
+	uint8_t hgIdx{_actvPrdsQty};
+	uint8_t midIdx{0};
+
+	if(prd > 0){
+		while(lwIdx < hgIdx){	// Binary search for the period position in the sorted list
+			midIdx = (lwIdx + hgIdx) / 2;
+			if(*(_actvPrdsLstPtr + midIdx) < prd)
+				lwIdx = midIdx + 1;
+			else
+				hgIdx = midIdx;
+		}
+		if((lwIdx < _actvPrdsQty) && (*(_actvPrdsLstPtr + lwIdx) == prd)){	// The period was already listed
+			++(*(_actvPrdsCntLstPtr + lwIdx));
+		}
+		else{	// The period is inserted at the found position, keeping the list sorted
+			unsigned long int* tmpPrdsLstPtr {new unsigned long int [_actvPrdsQty + 1]};
+			uint16_t* tmpCntLstPtr {new uint16_t [_actvPrdsQty + 1]};
+
+			for(uint8_t i{0}; i < _actvPrdsQty; ++i){
+				*(tmpPrdsLstPtr + i + ((i < lwIdx)?0:1)) = *(_actvPrdsLstPtr + i);
+				*(tmpCntLstPtr + i + ((i < lwIdx)?0:1)) = *(_actvPrdsCntLstPtr + i);
+			}
+			*(tmpPrdsLstPtr + lwIdx) = prd;
+			*(tmpCntLstPtr + lwIdx) = 1;
+			delete [] _actvPrdsLstPtr;
+			delete [] _actvPrdsCntLstPtr;
+			_actvPrdsLstPtr = tmpPrdsLstPtr;
+			_actvPrdsCntLstPtr = tmpCntLstPtr;
+			++_actvPrdsQty;
+			_actvPrdsMCD = (_actvPrdsMCD == 0)?prd:findMCD(_actvPrdsMCD, prd);
+		}
+	}
+
+	return;
+}
+
+void DbncdMPBttn::_armTmr(mpbTmr_t &tmr, const unsigned long int &ddln){
+	/*Arms the timer to expire at the ddln time, inserting it in the soft-timers list sorted by deadline. An armed timer
+	is moved to it's new position, so re-arming restarts it. The insertion is the only list traversal, the ticks check the head only*/
+	mpbTmr_t** nxtPtr{&_tmrsLstHd};
+
+	_MpbCrtclSctnBgn();
+	_unlnkTmr(tmr);
+	while((*nxtPtr != nullptr) && ((long)((*nxtPtr)->ddln - ddln) <= 0))
+		nxtPtr = &((*nxtPtr)->nxt);
+	tmr.ddln = ddln;
+	tmr.expd = false;
+	tmr.nxt = *nxtPtr;
+	*nxtPtr = &tmr;
+	tmr.armd = true;
+	_MpbCrtclSctnEnd();
+
+	return;
+}
+
+void DbncdMPBttn::_rmvActvPrd(const unsigned long int &prd){
+	/*Decrements the count of a listed poll period, removing it from the list when no timer attached
+	MPB uses it anymore. Only in that case the MCD of the remaining distinct periods is recalculated*/
+	uint8_t lwIdx{0};
+	uint8_t hgIdx{_actvPrdsQty};
+	uint8_t midIdx{0};
+
+	while(lwIdx < hgIdx){	// Binary search for the period position in the sorted list
+		midIdx = (lwIdx + hgIdx) / 2;
+		if(*(_actvPrdsLstPtr + midIdx) < prd)
+			lwIdx = midIdx + 1;
+		else
+			hgIdx = midIdx;
+	}
+	if((lwIdx < _actvPrdsQty) && (*(_actvPrdsLstPtr + lwIdx) == prd)){
+		if(*(_actvPrdsCntLstPtr + lwIdx) > 1){
+			--(*(_actvPrdsCntLstPtr + lwIdx));
+		}
+		else{	// Last MPB using the period, the period is taken out of the list
+			--_actvPrdsQty;
+			_actvPrdsMCD = 0;
+			if(_actvPrdsQty == 0){
+				delete [] _actvPrdsLstPtr;
+				delete [] _actvPrdsCntLstPtr;
+				_actvPrdsLstPtr = nullptr;
+				_actvPrdsCntLstPtr = nullptr;
+			}
+			else{
+				for(uint8_t i{lwIdx}; i < _actvPrdsQty; ++i){	// The list is compacted in place, the spare element is kept for the next insertion realloc
+					*(_actvPrdsLstPtr + i) = *(_actvPrdsLstPtr + i + 1);
+					*(_actvPrdsCntLstPtr + i) = *(_actvPrdsCntLstPtr + i + 1);
+				}
+				for(uint8_t i{0}; i < _actvPrdsQty; ++i)
+					_actvPrdsMCD = (_actvPrdsMCD == 0)?*(_actvPrdsLstPtr + i):findMCD(_actvPrdsMCD, *(_actvPrdsLstPtr + i));
+			}
+		}
+	}
+
+	return;
+}
+
+uint16_t DbncdMPBttn::_calcCfgCrc(const uint8_t* bufPtr, const uint16_t &bufSz){
+	// CRC-16/CCITT-FALSE (polynomial 0x1021, initial value 0xFFFF), bitwise to avoid a lookup table
+	uint16_t result{0xFFFF};
+
+	for(uint16_t i{0}; i < bufSz; ++i){
+		result ^= ((uint16_t)*(bufPtr + i)) << 8;
+		for(uint8_t bitCnt{0}; bitCnt < 8; ++bitCnt)
+			result = (result & 0x8000)?((result << 1) ^ 0x1021):(result << 1);
+	}
+
+	return result;
+}
+
+void DbncdMPBttn::_dsrmTmr(mpbTmr_t &tmr){
+	_MpbCrtclSctnBgn();
+	_unlnkTmr(tmr);
+	tmr.expd = false;
+	_MpbCrtclSctnEnd();
+
+	return;
+}
+
+uint16_t DbncdMPBttn::getCfgBlob(uint8_t* bufPtr, const uint16_t &bufSz, DbncdMPBttn** mpbsArr, const uint8_t &mpbsQty){
+	uint16_t result{0};
+	uint16_t blobSz{2};	// Format version and records quantity header
+	uint16_t crc{0};
+	DbncdMPBttn** lstPtr{(mpbsArr != nullptr)?mpbsArr:_mpbsInstncsLstPtr};
+	uint8_t lstQty{0};
+	uint8_t rcrdSz{0};
+	bool rcrdsOk{true};
+
+	if(mpbsArr != nullptr)
+		lstQty = mpbsQty;
+	else if(lstPtr != nullptr){
+		while((lstQty < 0xFF) && (*(lstPtr + lstQty) != nullptr))
+			++lstQty;
+	}
+	if((bufPtr != nullptr) && (lstQty > 0) && (bufSz >= 4)){
+		for(uint8_t i{0}; (i < lstQty) && rcrdsOk; ++i){
+			rcrdSz = 0;
+			if((*(lstPtr + i) != nullptr) && (bufSz - 2 > blobSz))
+				rcrdSz = (*(lstPtr + i))->getCfgRcrd(bufPtr + blobSz, ((bufSz - 2 - blobSz) > 0xFF)?0xFF:(bufSz - 2 - blobSz));
+			if(rcrdSz == 0)
+				rcrdsOk = false;
+			blobSz += rcrdSz;
+		}
+		if(rcrdsOk){
+			*bufPtr = _CfgFrmtVer;
+			*(bufPtr + 1) = lstQty;
+			crc = _calcCfgCrc(bufPtr, blobSz);
+			*(bufPtr + blobSz) = (uint8_t)crc;
+			*(bufPtr + blobSz + 1) = (uint8_t)(crc >> 8);
+			result = blobSz + 2;
+		}
+	}
+
+	return result;
+}
+
+bool DbncdMPBttn::getDrtyMpbs(){
+	bool result {false};
+
+	_MpbCrtclSctnBgn();
+	for(uint8_t i{0}; i < (_DrtyMpbsMax / 32); ++i){
+		if(_drtyMsk[i] != 0){
+			result = true;
+			break;
+		}
+	}
+	_MpbCrtclSctnEnd();
+
+	return result;
+}
+
+bool DbncdMPBttn::getNxtDdln(unsigned long int &ddln){
+	bool result{false};
+
+	_MpbCrtclSctnBgn();
+	if(_tmrsLstHd != nullptr){	// The list is sorted by deadline, the head holds the earliest pending expiry
+		ddln = _tmrsLstHd->ddln;
+		result = true;
+	}
+	_MpbCrtclSctnEnd();
+
+	return result;
+}
+
+uint32_t DbncdMPBttn::getSttsGnrtn(){
+	uint32_t result {0};
+
+	_MpbCrtclSctnBgn();
+	result = _sttsGnrtn;
+	_MpbCrtclSctnEnd();
+
+	return result;
+}
+
+uint8_t DbncdMPBttn::getSttsSnpsht(uint32_t* sttsArr, DbncdMPBttn** mpbsArr, const uint8_t &arrSz, uint32_t &gnrtn, const uint32_t &sncGnrtn){
+	uint8_t result {0};
+	int auxPtr{0};
+	DbncdMPBttn* mpbPtr {nullptr};
+
+	_MpbCrtclSctnBgn();
+	gnrtn = _sttsGnrtn;
+	if((_mpbsInstncsLstPtr != nullptr) && (sttsArr != nullptr)){
+		while(*(_mpbsInstncsLstPtr + auxPtr) != nullptr){
+			mpbPtr = *(_mpbsInstncsLstPtr + auxPtr);
+			if((sncGnrtn == 0) || (mpbPtr->_sttsGnrtnStmp > sncGnrtn)){
+				if(result < arrSz){
+					*(sttsArr + result) = mpbPtr->_otptsSttsPkg();
+					if(mpbsArr != nullptr)
+						*(mpbsArr + result) = mpbPtr;
+				}
+				if(result < 0xFF)
+					++result;
+			}
+			++auxPtr;
+		}
+	}
+	_MpbCrtclSctnEnd();
+
+	return result;
+}
+
+unsigned long int DbncdMPBttn::_getTmrRmnng(const mpbTmr_t &tmr){
+	unsigned long int result{0};
+	unsigned long int ddln{0};
+	bool armd{false};
+
+	_MpbCrtclSctnBgn();	// The 4 bytes deadline can't be read atomically in 8 bits architectures
+	armd = tmr.armd;
+	ddln = tmr.ddln;
+	_MpbCrtclSctnEnd();
+	if(armd){
+		result = ddln - millis();
+		if((long)result < 0)	// Deadline already reached, waiting for the next timer service to be flagged
+			result = 0;
+	}
+
+	return result;
+}
+
+DbncdMPBttn* DbncdMPBttn::popDrtyMpb(){
+	DbncdMPBttn* result {nullptr};
+	uint32_t wrdVal{0};
+	uint8_t bitIdx{0};
+
+	_MpbCrtclSctnBgn();
+	for(uint8_t i{0}; i < (_DrtyMpbsMax / 32); ++i){
+		wrdVal = _drtyMsk[i];
+		if(wrdVal != 0){
+			while((wrdVal & 0xFF) == 0){	// Skip the clean bytes first
+				wrdVal >>= 8;
+				bitIdx += 8;
+			}
+			while((wrdVal & 1) == 0){
+				wrdVal >>= 1;
+				++bitIdx;
+			}
+			_drtyMsk[i] &= ~(((uint32_t)1) << bitIdx);
+			result = *(_mpbsInstncsLstPtr + (i * 32) + bitIdx);
+			result->_outputsChange = false;	// Cleared with the bit, or the next bitmap rebuild would report the object again
+			break;
+		}
+	}
+	_MpbCrtclSctnEnd();
+
+	return result;
+}
+
+void DbncdMPBttn::_rbldDrtyMsk(){
+	/*Sets the objects position in the "MPBs to be updated list" after it is modified, and rebuilds the
+	"dirty objects" bitmap from the objects outputsChange flags, as the positions might have changed*/
+	int auxPtr{0};
+	DbncdMPBttn* mpbPtr {nullptr};
+
+	_MpbCrtclSctnBgn();
+	for(uint8_t i{0}; i < (_DrtyMpbsMax / 32); ++i)
+		_drtyMsk[i] = 0;
+	if(_mpbsInstncsLstPtr != nullptr){
+		while(*(_mpbsInstncsLstPtr + auxPtr) != nullptr){
+			mpbPtr = *(_mpbsInstncsLstPtr + auxPtr);
+			if(auxPtr < _DrtyMpbsMax){
+				mpbPtr->_lstIdx = auxPtr;
+				if(mpbPtr->_outputsChange)
+					_drtyMsk[auxPtr / 32] |= ((uint32_t)1) << (auxPtr % 32);
+			}
+			else{
+				mpbPtr->_lstIdx = 0xFF;
+			}
+			++auxPtr;
+		}
+	}
+	_MpbCrtclSctnEnd();
+
+	return;
+}
+
+uint8_t DbncdMPBttn::setCfgBlob(const uint8_t* blobPtr, const uint16_t &blobSz, DbncdMPBttn** mpbsArr, const uint8_t &mpbsQty){
+	uint8_t result{0};
+	uint16_t rdIdx{2};	// First record position, after the format version and records quantity header
+	DbncdMPBttn** lstPtr{(mpbsArr != nullptr)?mpbsArr:_mpbsInstncsLstPtr};
+	uint8_t lstQty{0};
+	uint8_t rcrdsQty{0};
+
+	if(mpbsArr != nullptr)
+		lstQty = mpbsQty;
+	else if(lstPtr != nullptr){
+		while((lstQty < 0xFF) && (*(lstPtr + lstQty) != nullptr))
+			++lstQty;
+	}
+	if((blobPtr != nullptr) && (blobSz >= 4) && (*blobPtr == _CfgFrmtVer)){
+		if(_calcCfgCrc(blobPtr, blobSz - 2) == (uint16_t)(*(blobPtr + blobSz - 2) | (((uint16_t)*(blobPtr + blobSz - 1)) << 8))){
+			rcrdsQty = *(blobPtr + 1);
+			for(uint8_t i{0}; (i < rcrdsQty) && (i < lstQty); ++i){
+				if((*(blobPtr + rdIdx) == 0) || ((rdIdx + *(blobPtr + rdIdx)) > (blobSz - 2)))	// Malformed record size, the rest of the records can't be located
+					break;
+				if((*(lstPtr + i) != nullptr) && (*(lstPtr + i))->setCfgRcrd(blobPtr + rdIdx, *(blobPtr + rdIdx)))
+					++result;
+				rdIdx += *(blobPtr + rdIdx);
+			}
+		}
+	}
+
+	return result;
+}
+
+void DbncdMPBttn::_srvcTmrs(const unsigned long int &curTm){
+	/*Invoked from the timer interrupt service: pops the expired timers from the head of the list and raises their expired flag.
+	The owners check the flag in their next poll*/
+	mpbTmr_t* tmrPtr{nullptr};
+
+	while((_tmrsLstHd != nullptr) && ((long)(curTm - _tmrsLstHd->ddln) >= 0)){
+		tmrPtr = _tmrsLstHd;
+		_tmrsLstHd = tmrPtr->nxt;
+		tmrPtr->nxt = nullptr;
+		tmrPtr->armd = false;
+		tmrPtr->expd = true;
+	}
+
+	return;
+}
+
+bool DbncdMPBttn::waitForChange(const unsigned long int &timeout, DbncdMPBttn** sbstArr, const uint8_t &sbstQty){
+	bool result {false};
+	bool tmdOut {false};
+	uint32_t sbstMsk[_DrtyMpbsMax / 32] {0};
+	unsigned long int strtTm {millis()};
+
+	if((sbstArr != nullptr) && (sbstQty > 0)){	// The subset mask is built once, the objects positions are not expected to change while waiting
+		for(uint8_t i{0}; i < sbstQty; ++i){
+			if((*(sbstArr + i) != nullptr) && ((*(sbstArr + i))->_lstIdx != 0xFF))
+				sbstMsk[(*(sbstArr + i))->_lstIdx / 32] |= ((uint32_t)1) << ((*(sbstArr + i))->_lstIdx % 32);
+		}
+	}
+	else if(_mpbsInstncsLstPtr != nullptr){
+		for(uint8_t i{0}; i < (_DrtyMpbsMax / 32); ++i)
+			sbstMsk[i] = 0xFFFFFFFF;
+	}
+	tmdOut = true;	// No tracked object to wait for, no change could ever be detected: the method returns with no waiting, whatever the timeout is
+	for(uint8_t i{0}; i < (_DrtyMpbsMax / 32); ++i){
+		if(sbstMsk[i] != 0){
+			tmdOut = false;
+			break;
+		}
+	}
+
+#if defined(_MpbHostBuild)
+	if(!tmdOut){	// The thread is blocked until a timer interrupt service execution finds the condition met, the timeout is measured with the simulated clock
+		std::unique_lock<std::mutex> hstLck(_mpbHstWaitMtx);
+		_mpbHstWaitCv.wait(hstLck, [&]{
+			for(uint8_t i{0}; i < (_DrtyMpbsMax / 32); ++i){
+				if((_drtyMsk[i] & sbstMsk[i]) != 0){
+					result = true;
+					break;
+				}
+			}
+			if(!result && (timeout > 0) && ((millis() - strtTm) >= timeout))
+				tmdOut = true;
+			return (result || tmdOut);
+		});
+	}
+#else
+#if defined(__AVR__)
+	set_sleep_mode(SLEEP_MODE_IDLE);
+#endif
+	while(!result && !tmdOut){
+#if defined(__AVR__)
+		cli();	// The condition is checked with interrupts disabled, so a change can't take place between the check and the sleep
+#else
+		noInterrupts();
+#endif
+		for(uint8_t i{0}; i < (_DrtyMpbsMax / 32); ++i){
+			if((_drtyMsk[i] & sbstMsk[i]) != 0){
+				result = true;
+				break;
+			}
+		}
+		if(!result && (timeout > 0) && ((millis() - strtTm) >= timeout))
+			tmdOut = true;
+#if defined(__AVR__)
+		if(!result && !tmdOut){	// The instruction following sei() is always executed before any pending interrupt, so the wake up interrupt can't be lost
+			sleep_enable();
+			sei();
+			sleep_cpu();
+			sleep_disable();
+		}
+		sei();
+#else
+		interrupts();
+		if(!result && !tmdOut)
+			yield();
+#endif
+	}
+#endif
+
+	return result;
+}
+
+void DbncdMPBttn::_unlnkTmr(mpbTmr_t &tmr){
+	//Removes an armed timer from the soft-timers list, the caller must provide the critical section
+	mpbTmr_t** nxtPtr{&_tmrsLstHd};
+
+	if(tmr.armd){
+		while((*nxtPtr != nullptr) && (*nxtPtr != &tmr))
+			nxtPtr = &((*nxtPtr)->nxt);
+		if(*nxtPtr == &tmr)
+			*nxtPtr = tmr.nxt;
+		tmr.nxt = nullptr;
+		tmr.armd = false;
+	}
+
+	return;
+}
+
+void DbncdMPBttn::_updTmrPrd(){
+	/*Recalculates the update timer period after any change in the attached MPBs set, and
+	reprograms, pauses or resumes the timer only if the period changed*/
+	unsigned long int tmpUpdTmrPrd {_updTmrsMCDCalc()};
+
+	if(_updTimerPeriod != tmpUpdTmrPrd){
+		if(tmpUpdTmrPrd == 0){	//No active MPBs where found in the "MPBs to be updated list", set the timer to pause
+			Timer1.stop();
+		}
+		else{
+			Timer1.setPeriod(tmpUpdTmrPrd * 1000);
+			if(_updTimerPeriod == 0)	//The timer was paused
+				Timer1.resume();
+		}
+		_updTimerPeriod = tmpUpdTmrPrd;
+	}
+
+	return;
+}
 //===========================>> END Base Class Static methods implementation
 
 DbncdMPBttn::DbncdMPBttn()
@@ -140,6 +689,16 @@ DbncdMPBttn::DbncdMPBttn(const DbncdMPBttn &other)
 	_fnVdPtrPrmWhnTrnOnArgPtr = other._fnVdPtrPrmWhnTrnOnArgPtr;
 	_fnVdPtrPrmWhnTrnOffArgPtr = other._fnVdPtrPrmWhnTrnOffArgPtr;
 	_dbncRlsTimeTempSett = other._dbncRlsTimeTempSett;
+	_dbncRlsAuto = other._dbncRlsAuto;
+	_rlsDelay = other._rlsDelay;
+	_fltrSmplsQty = other._fltrSmplsQty;
+	_fltrVtsQty = other._fltrVtsQty;
+	_fltrSmplsMsk = other._fltrSmplsMsk;
+	_fltrSmplsReg = other._fltrSmplsReg;
+	_fltrPrssdCnt = other._fltrPrssdCnt;
+	_inptPrvdr = other._inptPrvdr;
+	_inptFnc = other._inptFnc;
+	_inptFncArgPtr = other._inptFncArgPtr;
 	_dbncTimerStrt = other._dbncTimerStrt;
 	_dbncRlsTimerStrt = other._dbncRlsTimerStrt;
 	_prssRlsCcl = other._prssRlsCcl;
@@ -155,33 +714,59 @@ DbncdMPBttn::DbncdMPBttn(const DbncdMPBttn &other)
 DbncdMPBttn::~DbncdMPBttn(){
     
 	end();  // Stops the software timer associated to the object, deletes it's entry and nullyfies the handle to it before destructing the object
+	delete [] _otptPinsPtr;
+}
+
+bool DbncdMPBttn::addSttLstnr(MpbSttLstnr* newSttLstnr){
+	bool result {false};
+	uint8_t freeIdx {_SttLstnrsMax};
+
+	if(newSttLstnr != nullptr){
+		_MpbCrtclSctnBgn();
+		for(uint8_t i{0}; i < _SttLstnrsMax; ++i){
+			if(_sttLstnrs[i] == newSttLstnr){	// Already set, no duplicates are added
+				result = true;
+				break;
+			}
+			if((_sttLstnrs[i] == nullptr) && (freeIdx == _SttLstnrsMax))
+				freeIdx = i;
+		}
+		if(!result && (freeIdx < _SttLstnrsMax)){
+			_sttLstnrs[freeIdx] = newSttLstnr;
+			result = true;
+		}
+		_MpbCrtclSctnEnd();
+	}
+
+	return result;
 }
 
 bool DbncdMPBttn::begin(const unsigned long int &pollDelayMs) {
 	bool result {false};
 
-	pinMode(_mpbttnPin, (_pulledUp == true)?INPUT_PULLUP:INPUT);
+	if((_inptPrvdr == nullptr) && (_inptFnc == nullptr))	// The input signal is read from a GPIO pin
+		pinMode(_mpbttnPin, (_pulledUp == true)?INPUT_PULLUP:INPUT);
 	if(_beginDisabled){
 		_isEnabled = false;
 		_validDisablePend = true;
 	}
 
 	if (pollDelayMs > 0){
+		_setUpdTmrAttchd(false);	// If begin() is invoked again for an already attached MPB, it's previous poll period is released before setting the new one
 		_pollPeriodMs = pollDelayMs;	// Set this MPB's PollPeriodMs to the provided argument
-		_updTmrAttchd = true;	//Set the MPB object to be updated by the Timer. By manipulating the attribute (instead of ) the global _updTimerPeriod is not recalculated
+		_setUpdTmrAttchd(true);	//Set the MPB object to be updated by the Timer. The global _updTimerPeriod is not recalculated by this method
 		_pushMpb(_mpbsInstncsLstPtr, _mpbInstnc);	// Add the MPB to the "MPBs to be updated list"
+		_inUpdLst = true;
+		_rbldDrtyMsk();
 
 		if (_updTimerPeriod == 0){   // The timer was not running (empty list or all listed objects not attached to the refresh)
-			_updTimerPeriod = _pollPeriodMs;	//! As at this moment this is the only active MPB it's poll time is THE int time, otherwise the line would be _updTimerPeriod = _updTmrsMCDCalc();
+			_updTimerPeriod = _updTmrsMCDCalc();
 			Timer1.attachInterrupt(_ISRMpbsRfrshCb);
 			Timer1.initialize(_updTimerPeriod * 1000);	// The MPBs manages times in milliseconds, the timer in microseconds
 			Timer1.start();			
 		}
 		else{	// The "MPBs to be updated list" was not empty, pollTime must be recalculated and if changes set Timer1.setPeriod() invoked
-			if(_pollPeriodMs != _updTimerPeriod){
-				_updTimerPeriod = _updTmrsMCDCalc();
-				Timer1.setPeriod(_updTimerPeriod * 1000);
-			}
+			_updTmrPrd();
 		}
 		result = true;
 	}
@@ -189,6 +774,42 @@ bool DbncdMPBttn::begin(const unsigned long int &pollDelayMs) {
    return result;
 }
 
+void DbncdMPBttn::_cfgPkg(uint8_t* &bufPtr){
+	// Each class appends it's own tunable attributes after the ones of it's superclass, the layout is identified by _getCfgClsId()
+	_cfgWrt(bufPtr, (_beginDisabled?0x01:0x00) | (_dbncRlsAuto?0x02:0x00) | (_isOnDisabled?0x04:0x00), 1);
+	_cfgWrt(bufPtr, _dbncTimeTempSett, 4);
+	_cfgWrt(bufPtr, _dbncRlsTimeTempSett, 4);
+	_cfgWrt(bufPtr, _rlsDelay, 4);
+	_cfgWrt(bufPtr, _fltrSmplsQty, 1);
+	_cfgWrt(bufPtr, _fltrVtsQty, 1);
+
+	return;
+}
+
+bool DbncdMPBttn::_cfgUnpkg(const uint8_t* &bufPtr){
+	uint8_t cfgFlgs{(uint8_t)_cfgRd(bufPtr, 1)};
+	unsigned long int dbncTm{_cfgRd(bufPtr, 4)};
+	unsigned long int dbncRlsTm{_cfgRd(bufPtr, 4)};
+	unsigned long int rlsDly{_cfgRd(bufPtr, 4)};
+	uint8_t fltrSmplsQty{(uint8_t)_cfgRd(bufPtr, 1)};
+	uint8_t fltrVtsQty{(uint8_t)_cfgRd(bufPtr, 1)};
+	bool result{true};
+
+	setBeginDisabled(cfgFlgs & 0x01);
+	if(!setDbncTime(dbncTm))
+		result = false;
+	if(cfgFlgs & 0x02)
+		setDbncRlsAuto(true);
+	else if(!setDbncRlsTime(dbncRlsTm))
+		result = false;
+	setRlsDelay(rlsDly);
+	if(!setGlitchFltr(fltrSmplsQty, fltrVtsQty))
+		result = false;
+	setIsOnDisabled(cfgFlgs & 0x04);
+
+	return result;
+}
+
 void DbncdMPBttn::clrStatus(bool clrIsOn){
 	/*To Resume operations after a pause() without risking generating false "Valid presses" and "On" situations,
 	several attributes must be resetted to "Start" values.
@@ -203,6 +824,8 @@ void DbncdMPBttn::clrStatus(bool clrIsOn){
 		if(_isOn)
 			_turnOff();
 	}
+	if(_otptPinsPtr != nullptr)	// Subclasses flags might have been directly reset before invoking this method, the bound pins are refreshed
+		_wrtOtptPins();
     
 	return;
 }
@@ -229,6 +852,9 @@ bool DbncdMPBttn::end(){
 	result = pause();	//Will mark the object as non updatable, recalculate the update time and sets the timer period, or stops it if no updatable objects are left in the list.
 	if (result){
 		_popMpb(_mpbsInstncsLstPtr, _mpbInstnc);	// Removes the MPB from the "MPBs to be updated list". If the list is empty after the removal this method deletes the list.
+		_inUpdLst = false;
+		_lstIdx = 0xFF;
+		_rbldDrtyMsk();
 		if(_mpbsInstncsLstPtr == nullptr){	// The "MPBs to be updated list" is empty, stop the Timer1
 			_updTimerPeriod = 0;
 			Timer1.stop();
@@ -239,11 +865,70 @@ bool DbncdMPBttn::end(){
    return result;
 }
 
+uint8_t DbncdMPBttn::getCfgRcrd(uint8_t* bufPtr, const uint8_t &bufSz){
+	uint8_t result{0};
+	uint8_t rcrdBuf[_CfgRcrdMax]{};
+	uint8_t* wrtPtr{rcrdBuf + 3};	// After the record size, format version and class layout identifier header
+	uint8_t rcrdSz{0};
+	uint16_t crc{0};
+
+	_cfgPkg(wrtPtr);
+	rcrdSz = (uint8_t)(wrtPtr - rcrdBuf) + 2;
+	if((bufPtr != nullptr) && (rcrdSz <= bufSz)){
+		rcrdBuf[0] = rcrdSz;
+		rcrdBuf[1] = _CfgFrmtVer;
+		rcrdBuf[2] = _getCfgClsId();
+		crc = _calcCfgCrc(rcrdBuf, rcrdSz - 2);
+		rcrdBuf[rcrdSz - 2] = (uint8_t)crc;
+		rcrdBuf[rcrdSz - 1] = (uint8_t)(crc >> 8);
+		for(uint8_t i{0}; i < rcrdSz; ++i)
+			*(bufPtr + i) = rcrdBuf[i];
+		result = rcrdSz;
+	}
+
+	return result;
+}
+
+uint8_t DbncdMPBttn::_getCfgClsId(){
+
+	return 1;	// Configuration record layout identifier, unique for each class adding tunable attributes
+}
+
+const unsigned long int DbncdMPBttn::getCurDbncRlsTime() const{
+
+	return _dbncRlsTimeTempSett;
+}
+
 const unsigned long int DbncdMPBttn::getCurDbncTime() const{
 
     return _dbncTimeTempSett;
 }
 
+const bool DbncdMPBttn::getDbncRlsAuto() const{
+
+	return _dbncRlsAuto;
+}
+
+bool DbncdMPBttn::_fltrGlitch(const bool &rawIsPressed){
+	/*The samples register keeps the last _fltrSmplsQty readings, the newest in bit 0.
+	The _fltrPrssdCnt keeps the number of "pressed" readings in the register, updated
+	with the reading entering and the reading leaving the window, so no bits counting is needed.*/
+	bool result {_isPressed};
+
+	if(_fltrSmplsReg & (_fltrSmplsMsk ^ (_fltrSmplsMsk >> 1)))	// The oldest reading leaves the window
+		--_fltrPrssdCnt;
+	_fltrSmplsReg = ((_fltrSmplsReg << 1) | (rawIsPressed?1:0)) & _fltrSmplsMsk;
+	if(rawIsPressed)
+		++_fltrPrssdCnt;
+
+	if(_fltrPrssdCnt >= _fltrVtsQty)
+		result = true;
+	else if((_fltrSmplsQty - _fltrPrssdCnt) >= _fltrVtsQty)
+		result = false;
+
+	return result;
+}
+
 fncPtrType DbncdMPBttn::getFnWhnTrnOff(){
 
 	return _fnWhnTrnOff;
@@ -274,6 +959,26 @@ void* DbncdMPBttn::getFVPPWhnTrnOnArgPtr(){
 	return _fnVdPtrPrmWhnTrnOnArgPtr;
 }
 
+uint8_t DbncdMPBttn::getGlitchFltrSmpls(){
+
+	return _fltrSmplsQty;
+}
+
+uint8_t DbncdMPBttn::getGlitchFltrVts(){
+
+	return _fltrVtsQty;
+}
+
+fncBlVdPtrPrmPtrType DbncdMPBttn::getInptFnc(){
+
+	return _inptFnc;
+}
+
+MpbInptPrvdr* DbncdMPBttn::getInptPrvdr(){
+
+	return _inptPrvdr;
+}
+
 const bool DbncdMPBttn::getIsEnabled() const{
 
 	return _isEnabled;
@@ -299,6 +1004,15 @@ const unsigned long int DbncdMPBttn::getLstPollTime(){
 	return _lstPollTime;
 }
 
+uint8_t DbncdMPBttn::getOtptPin(const uint8_t &otptBitPos){
+	uint8_t result{_InvalidPinNum};
+
+	if((otptBitPos <= IsOnScndryBitPos) && (_otptPinsPtr != nullptr))
+		result = _otptPinsPtr[otptBitPos].pin;
+
+	return result;
+}
+
 const uint32_t DbncdMPBttn::getOtptsSttsPkgd(){
 
 	return _otptsSttsPkg();
@@ -314,11 +1028,25 @@ const unsigned long int DbncdMPBttn::getPollPeriodMs() {
    return _pollPeriodMs;
 }
 
+unsigned long int DbncdMPBttn::getRlsDelay(){
+
+	return _rlsDelay;
+}
+
 unsigned long int DbncdMPBttn::getStrtDelay(){
 
 	return _strtDelay;
 }
 
+MpbSttLstnr* DbncdMPBttn::getSttLstnr(const uint8_t &lstnrIdx){
+	MpbSttLstnr* result {nullptr};
+
+	if(lstnrIdx < _SttLstnrsMax)
+		result = _sttLstnrs[lstnrIdx];
+
+	return result;
+}
+
 bool DbncdMPBttn::getUpdTmrAttchd(){
 
 	return _updTmrAttchd;
@@ -336,7 +1064,8 @@ bool DbncdMPBttn::init(const uint8_t &mpbttnPin, const bool &pulledUp, const boo
 		if(_dbncTimeOrigSett < _stdMinDbncTime) //Best practice would impose failing the constructor (throwing an exception or building a "zombie" object)
 			_dbncTimeOrigSett = _stdMinDbncTime;    //this tolerant approach taken for developers benefit, but object will be no faithful to the instantiation parameters
 		_dbncTimeTempSett = _dbncTimeOrigSett;
-		pinMode(mpbttnPin, (pulledUp == true)?INPUT_PULLUP:INPUT);
+		if((_inptPrvdr == nullptr) && (_inptFnc == nullptr))
+			pinMode(mpbttnPin, (pulledUp == true)?INPUT_PULLUP:INPUT);
 		result = true;
 	}
 	else{
@@ -376,42 +1105,23 @@ uint32_t DbncdMPBttn::_otptsSttsPkg(uint32_t prevVal){
 
 bool DbncdMPBttn::pause(){
    bool result {false};
+
+	if(_inUpdLst){	// This MPBttn is in the "MPBs to be updated list"
+		if (_updTmrAttchd == true){	// And was attached to the update timer
+			_setUpdTmrAttchd(false);
+			_updTmrPrd();
+		}
+		result = true;
+	}
+
+   return result;
+}
+
+void DbncdMPBttn::_popMpb(DbncdMPBttn** &DMpbTmrUpdLst, DbncdMPBttn* mpbToPop){
 	int arrSize{0};
+	int auxPtr{0};
 	bool mpbFnd{false};
-
-	if(_mpbsInstncsLstPtr != nullptr){	// If there is no "MPBs to be updated list", this object can't be in the list
-		while(*(_mpbsInstncsLstPtr + arrSize) != nullptr){
-			if(*(_mpbsInstncsLstPtr + arrSize) == _mpbInstnc){
-				mpbFnd = true;
-				break;
-			}
-			else{
-				++arrSize;
-			}
-		}
-		if(mpbFnd){	// This MPBttn was found in the "MPBs to be updated list"
-			if (_updTmrAttchd == true){	// And was attached to the update timer
-				_updTmrAttchd = false;
-				_updTimerPeriod = _updTmrsMCDCalc();
-				if(_updTimerPeriod == 0){	//No active MPBs where found in the "MPBs to be updated list", set the timer to pause
-					Timer1.stop();
-				}
-				else{
-					Timer1.setPeriod(_updTimerPeriod * 1000);
-				}
-			}
-			result = true;
-		}
-	}
-
-   return result;
-}
-
-void DbncdMPBttn::_popMpb(DbncdMPBttn** &DMpbTmrUpdLst, DbncdMPBttn* mpbToPop){
-	int arrSize{0};
-	int auxPtr{0};
-	bool mpbFnd{false};
-	DbncdMPBttn** tmpArrPtr{nullptr};
+	DbncdMPBttn** tmpArrPtr{nullptr};
 
 	while(*(DMpbTmrUpdLst + arrSize) != nullptr){
 		if(*(DMpbTmrUpdLst + arrSize) == mpbToPop){
@@ -486,7 +1196,7 @@ void DbncdMPBttn::resetDbncTime(){
 }
 
 void DbncdMPBttn::resetFda(){
-	clrStatus(true);
+	DbncdMPBttn::clrStatus(true);
 	setSttChng();
 	_mpbFdaState = stOffNotVPP;
 
@@ -494,44 +1204,40 @@ void DbncdMPBttn::resetFda(){
 }
 
 bool DbncdMPBttn::resume(){
-	int arrSize{0};
-	bool mpbFnd{false};
    bool result {false};
-	unsigned long int tmpUpdTmrPrd{0};
 
-	if(_mpbsInstncsLstPtr != nullptr){	// If there is no "MPBs to be updated list", this object can't be in the list to be resumed
-		while(*(_mpbsInstncsLstPtr + arrSize) != nullptr){
-			if(*(_mpbsInstncsLstPtr + arrSize) == _mpbInstnc){
-				mpbFnd = true;
-				break;
-			}
-			else{
-				++arrSize;
+	if(_inUpdLst){	// This MPBttn is in the "MPBs to be updated list"
+		if (_updTmrAttchd == false){	// And it was not attached to the update timer: attach and calculate updTimerPeriod
+			if(_pollPeriodMs > 0){	// The periodic polling time is a non-zero value, it can be resumed, else it fails
+				resetFda();	// To restart in a safe situation the FDA is resetted to have all flags and timers cleaned up
+				_setUpdTmrAttchd(true);
+				_updTmrPrd();
+				result = true;
 			}
 		}
-		if(mpbFnd){	// This MPBttn was found in the "MPBs to be updated list"
-			if (_updTmrAttchd == false){	// And it was not attached to the update timer: attach and calculate updTimerPeriod
-				if(_pollPeriodMs > 0){	// The periodic polling time is a non-zero value, it can be resumed, else it fails
-				   resetFda();	// To restart in a safe situation the FDA is resetted to have all flags and timers cleaned up
-					_updTmrAttchd = true;
-					tmpUpdTmrPrd = _updTmrsMCDCalc();
-					if(_updTimerPeriod != tmpUpdTmrPrd){
-						Timer1.setPeriod(tmpUpdTmrPrd * 1000);
-						if(_updTimerPeriod == 0){	//No active MPBs where found in the "MPBs to be updated list", set the timer to pause
-							Timer1.resume();
-						}
-						_updTimerPeriod = tmpUpdTmrPrd;
-					}
-					result = true;
-				}
-			}
-			else{	// The object was in the "MPBs to be updated list" and was set to be updated, no need for further changes, reply success
+		else{	// The object was in the "MPBs to be updated list" and was set to be updated, no need for further changes, reply success
+			result = true;
+		}
+	}
+
+   return result;
+}
+
+bool DbncdMPBttn::rmvSttLstnr(MpbSttLstnr* sttLstnr){
+	bool result {false};
+
+	if(sttLstnr != nullptr){
+		_MpbCrtclSctnBgn();
+		for(uint8_t i{0}; i < _SttLstnrsMax; ++i){
+			if(_sttLstnrs[i] == sttLstnr){
+				_sttLstnrs[i] = nullptr;
 				result = true;
 			}
 		}
+		_MpbCrtclSctnEnd();
 	}
 
-   return result;
+	return result;
 }
 
 void DbncdMPBttn::setBeginDisabled(const bool &newBeginDisabled){
@@ -541,12 +1247,57 @@ void DbncdMPBttn::setBeginDisabled(const bool &newBeginDisabled){
 	return;
 }
 
+bool DbncdMPBttn::setCfgRcrd(const uint8_t* rcrdPtr, const uint8_t &rcrdSz){
+	bool result{false};
+	uint8_t rcrdBuf[_CfgRcrdMax]{};
+	uint8_t* wrtPtr{rcrdBuf};
+	const uint8_t* rdPtr{rcrdPtr + 3};	// After the record size, format version and class layout identifier header
+
+	if((rcrdPtr != nullptr) && (rcrdSz > 5) && (rcrdSz <= _CfgRcrdMax) && (*rcrdPtr == rcrdSz) && (*(rcrdPtr + 1) == _CfgFrmtVer) && (*(rcrdPtr + 2) == _getCfgClsId())){
+		_cfgPkg(wrtPtr);	// The current configuration is packaged just to get the expected record size
+		if(((uint8_t)(wrtPtr - rcrdBuf) + 5) == rcrdSz){
+			if(_calcCfgCrc(rcrdPtr, rcrdSz - 2) == (uint16_t)(*(rcrdPtr + rcrdSz - 2) | (((uint16_t)*(rcrdPtr + rcrdSz - 1)) << 8))){
+				result = _cfgUnpkg(rdPtr);
+			}
+		}
+	}
+
+	return result;
+}
+
+void DbncdMPBttn::setDbncRlsAuto(const bool &newDbncRlsAuto){
+	if(_dbncRlsAuto != newDbncRlsAuto){
+		_dbncRlsAuto = newDbncRlsAuto;
+		if(_dbncRlsAuto)
+			_dbncRlsTimeTempSett = _dbncTimeTempSett;
+	}
+
+	return;
+}
+
+bool DbncdMPBttn::setDbncRlsTime(const unsigned long int &newDbncRlsTime){
+	bool result {true};
+
+	if((newDbncRlsTime == 0) || (newDbncRlsTime >= _stdMinDbncTime)){
+		if(_dbncRlsTimeTempSett != newDbncRlsTime)
+			_dbncRlsTimeTempSett = newDbncRlsTime;
+		_dbncRlsAuto = false;
+	}
+	else{
+		result = false;
+	}
+
+	return result;
+}
+
 bool DbncdMPBttn::setDbncTime(const unsigned long int &newDbncTime){
 	bool result {true};
 
 	if(_dbncTimeTempSett != newDbncTime){
 		if (newDbncTime >= _stdMinDbncTime){
 			_dbncTimeTempSett = newDbncTime;
+			if(_dbncRlsAuto)
+				_dbncRlsTimeTempSett = _dbncTimeTempSett;
 		}
 		else{
 			result = false;
@@ -602,6 +1353,32 @@ void DbncdMPBttn::setFVPPWhnTrnOnArgPtr(void* newFVPPWhnTrnOnArgPtr){
 	return;
 }
 
+bool DbncdMPBttn::setGlitchFltr(const uint8_t &smplsQty, const uint8_t &vtsQty){
+	bool result {false};
+
+	if(smplsQty == 0)
+		result = true;
+	else if((smplsQty >= 2) && (smplsQty <= 16) && (vtsQty > (smplsQty / 2)) && (vtsQty <= smplsQty))
+		result = true;
+	if(result){
+		_MpbCrtclSctnBgn();	// The filter attributes are used as a set by the timer interrupt service
+		if(smplsQty == 0){
+			_fltrSmplsQty = 0;
+			_fltrVtsQty = 0;
+		}
+		else{
+			_fltrSmplsQty = smplsQty;
+			_fltrVtsQty = vtsQty;
+			_fltrSmplsMsk = (uint16_t)((((uint32_t)1) << smplsQty) - 1);
+		}
+		_fltrSmplsReg = 0;
+		_fltrPrssdCnt = 0;
+		_MpbCrtclSctnEnd();
+	}
+
+	return result;
+}
+
 void DbncdMPBttn::_setIsEnabled(const bool &newEnabledValue){
 	if(_isEnabled != newEnabledValue){
 		if (newEnabledValue){  //Change to Enabled = true
@@ -619,6 +1396,27 @@ void DbncdMPBttn::_setIsEnabled(const bool &newEnabledValue){
 	return;
 }
 
+void DbncdMPBttn::setInptFnc(fncBlVdPtrPrmPtrType newInptFnc, void* argPtr){
+	_MpbCrtclSctnBgn();	// The function and it's argument are used as a pair by the timer interrupt service
+	_inptFnc = newInptFnc;
+	_inptFncArgPtr = argPtr;
+	if(_inptFnc != nullptr)
+		_inptPrvdr = nullptr;
+	_MpbCrtclSctnEnd();
+
+	return;
+}
+
+void DbncdMPBttn::setInptPrvdr(MpbInptPrvdr* newInptPrvdr){
+	_MpbCrtclSctnBgn();
+	_inptPrvdr = newInptPrvdr;
+	if(_inptPrvdr != nullptr)
+		_inptFnc = nullptr;
+	_MpbCrtclSctnEnd();
+
+	return;
+}
+
 void DbncdMPBttn::setIsOnDisabled(const bool &newIsOnDisabled){
 	if(_isOnDisabled != newIsOnDisabled){
 		_isOnDisabled = newIsOnDisabled;
@@ -642,19 +1440,132 @@ void DbncdMPBttn::_setLstPollTime(const unsigned long int &newLstPollTIme){
 	return;
 }
 
+bool DbncdMPBttn::setOtptPin(const uint8_t &otptBitPos, const uint8_t &pin, const bool &actvHgh){
+	bool result{false};
+	bool pinVld{true};
+
+#if defined(__AVR__)
+	if(pin != _InvalidPinNum){	// The port register and bit mask tables are indexed by pin number without range checking
+#if defined(NUM_DIGITAL_PINS)
+		if(pin >= NUM_DIGITAL_PINS)
+			pinVld = false;
+		else
+#endif
+		if(digitalPinToPort(pin) == NOT_A_PIN)
+			pinVld = false;
+	}
+#endif
+	if((otptBitPos <= IsOnScndryBitPos) && pinVld){
+		if((_otptPinsPtr == nullptr) && (pin != _InvalidPinNum))
+			_otptPinsPtr = new mpbOtptPin_t[IsOnScndryBitPos + 1];
+		if(_otptPinsPtr != nullptr){
+			_MpbCrtclSctnBgn();
+			_otptPinsPtr[otptBitPos].pin = pin;
+			_otptPinsPtr[otptBitPos].actvHgh = actvHgh;
+			_otptPinsPtr[otptBitPos].otptBnk = nullptr;
+#if defined(__AVR__)
+			if(pin != _InvalidPinNum){
+				_otptPinsPtr[otptBitPos].portReg = portOutputRegister(digitalPinToPort(pin));
+				_otptPinsPtr[otptBitPos].pinMsk = digitalPinToBitMask(pin);
+			}
+#endif
+			_MpbCrtclSctnEnd();
+			if(pin != _InvalidPinNum){
+				pinMode(pin, OUTPUT);
+#if defined(__AVR__)
+				digitalWrite(pin, ((((_otptsSttsPkg() >> otptBitPos) & 0x01) != 0) == actvHgh) ? HIGH : LOW);	// digitalWrite() stops a PWM running on the pin, the direct port writes don't
+#endif
+				_wrtOtptPins(true);
+			}
+			result = true;
+		}
+		else if(pin == _InvalidPinNum)	// Nothing bound, nothing to remove
+			result = true;
+	}
+
+	return result;
+}
+
+bool DbncdMPBttn::setOtptPin(const uint8_t &otptBitPos, ShftRgstrOtptBnk* otptBnk, const uint8_t &otptId, const bool &actvHgh){
+	bool result{false};
+
+	if(otptBnk == nullptr){
+		if((otptBitPos <= IsOnScndryBitPos) && (_otptPinsPtr != nullptr) && (_otptPinsPtr[otptBitPos].otptBnk != nullptr)){
+			_MpbCrtclSctnBgn();
+			_otptPinsPtr[otptBitPos].otptBnk->_setOtptImgLvl(_otptPinsPtr[otptBitPos].pin, LOW);	// The unbound output is released, not left latched at the last written level
+			_MpbCrtclSctnEnd();
+			result = setOtptPin(otptBitPos, _InvalidPinNum);
+		}
+		else
+			result = (otptBitPos <= IsOnScndryBitPos);
+	}
+	else if((otptBitPos <= IsOnScndryBitPos) && (otptId < otptBnk->getOtptsQty()) && (otptId != _InvalidPinNum)){
+		if(_otptPinsPtr == nullptr)
+			_otptPinsPtr = new mpbOtptPin_t[IsOnScndryBitPos + 1];
+		if(_otptPinsPtr != nullptr){
+			_MpbCrtclSctnBgn();
+			_otptPinsPtr[otptBitPos].pin = otptId;
+			_otptPinsPtr[otptBitPos].actvHgh = actvHgh;
+			_otptPinsPtr[otptBitPos].otptBnk = otptBnk;
+			_MpbCrtclSctnEnd();
+			_wrtOtptPins(true);
+			result = true;
+		}
+	}
+
+	return result;
+}
+
 void DbncdMPBttn::setOutputsChange(bool newOutputsChange){
 	if(_outputsChange != newOutputsChange)
    	_outputsChange = newOutputsChange;
+	_MpbCrtclSctnBgn();
+	if(newOutputsChange){	// Every outputs change is stamped, even if the previous one wasn't yet processed
+		_sttsGnrtnStmp = ++_sttsGnrtn;
+		if(_lstIdx != 0xFF)
+			_drtyMsk[_lstIdx / 32] |= ((uint32_t)1) << (_lstIdx % 32);
+	}
+	else{
+		if(_lstIdx != 0xFF)
+			_drtyMsk[_lstIdx / 32] &= ~(((uint32_t)1) << (_lstIdx % 32));
+	}
+	_MpbCrtclSctnEnd();
+	if(newOutputsChange && (_otptPinsPtr != nullptr))
+		_wrtOtptPins();
 
    return;
 }
 
+void DbncdMPBttn::setRlsDelay(const unsigned long int &newRlsDelay){
+	if(_rlsDelay != newRlsDelay)
+		_rlsDelay = newRlsDelay;
+
+	return;
+}
+
 void DbncdMPBttn::setSttChng(){
 	_sttChng = true;
 
 	return;
 }
 
+void DbncdMPBttn::_setUpdTmrAttchd(const bool &newUpdTmrAttchd){
+	/*Sets the timer attached flag, keeping the active poll periods list updated.
+	The poll period registered is saved, to release the same value even if _pollPeriodMs is changed meanwhile*/
+	if(_actvPrd != 0){
+		_rmvActvPrd(_actvPrd);
+		_actvPrd = 0;
+	}
+	if(newUpdTmrAttchd && (_pollPeriodMs > 0)){
+		_addActvPrd(_pollPeriodMs);
+		_actvPrd = _pollPeriodMs;
+	}
+	if(_updTmrAttchd != newUpdTmrAttchd)
+		_updTmrAttchd = newUpdTmrAttchd;
+
+	return;
+}
+
 void DbncdMPBttn::_turnOff(){
 
 	if(_isOn){
@@ -667,7 +1578,12 @@ void DbncdMPBttn::_turnOff(){
 		}
 		//---------------->> Flags related actions
 		_isOn = false;
-		_outputsChange = true;
+		setOutputsChange(true);
+		//---------------->> Listeners related actions
+		for(uint8_t i{0}; i < _SttLstnrsMax; ++i){
+			if(_sttLstnrs[i] != nullptr)
+				_sttLstnrs[i]->mpbTrndOff(this);
+		}
 	}
 
 	return;
@@ -685,7 +1601,12 @@ void DbncdMPBttn::_turnOn(){
 			}
 		//---------------->> Flags related actions
 		_isOn = true;
-		_outputsChange = true;
+		setOutputsChange(true);
+		//---------------->> Listeners related actions
+		for(uint8_t i{0}; i < _SttLstnrsMax; ++i){
+			if(_sttLstnrs[i] != nullptr)
+				_sttLstnrs[i]->mpbTrndOn(this);
+		}
 	}
 
 	return;
@@ -696,7 +1617,7 @@ void DbncdMPBttn::updFdaState(){
 		case stOffNotVPP:
 			//In: >>---------------------------------->>
 			if(_sttChng){
-				clrStatus(true);
+				DbncdMPBttn::clrStatus(true);
 				clrSttChng();
 			}	// Execute this code only ONCE, when entering this state
 			//Do: >>---------------------------------->>
@@ -763,10 +1684,9 @@ void DbncdMPBttn::updFdaState(){
 					else
 						_turnOn();
 				}
-				clrStatus(false);	//Clears all flags and timers, _isOn value will not be affected
+				DbncdMPBttn::clrStatus(false);	//Clears all flags and timers, _isOn value will not be affected
 				_isEnabled = false;
-				if(!_outputsChange)
-					_outputsChange = true;
+				setOutputsChange(true);
 				_validDisablePend = false;
 				clrSttChng();
 			}	// Execute this code only ONCE, when entering this state
@@ -776,8 +1696,7 @@ void DbncdMPBttn::updFdaState(){
 					_turnOff();
 				_isEnabled = true;
 				_validEnablePend = false;
-				if(!_outputsChange)
-					_outputsChange = true;
+				setOutputsChange(true);
 			}
 			if(_isEnabled && !updIsPressed()){	//The stDisabled status will be kept until the MPB is released for security reasons
 				_mpbFdaState = stOffNotVPP;
@@ -785,7 +1704,7 @@ void DbncdMPBttn::updFdaState(){
 			}
 			//Out: >>---------------------------------->>
 			if(_sttChng){	// Execute this code only ONCE, when exiting this state
-				clrStatus(true);	//Uneeded as is the first function executed in the next state (stOffNotVPP), but this ensures that state can be modified without affecting this one
+				DbncdMPBttn::clrStatus(true);	//Uneeded as is the first function executed in the next state (stOffNotVPP), but this ensures that state can be modified without affecting this one
 			}
 			break;
 
@@ -806,7 +1725,14 @@ bool DbncdMPBttn::updIsPressed(){
 		b)  _pulledUp == true ==> digitalRead == HIGH
 	*/
 	bool result {false};
-	bool tmpPinLvl {digitalRead(_mpbttnPin)};
+	bool tmpPinLvl {};
+
+	if(_inptPrvdr != nullptr)
+		tmpPinLvl = _inptPrvdr->getInptLvl(_mpbttnPin);
+	else if(_inptFnc != nullptr)
+		tmpPinLvl = _inptFnc(_inptFncArgPtr);
+	else
+		tmpPinLvl = (digitalRead(_mpbttnPin) == HIGH);
     
 	if (_typeNO == true){
 		//For NO MPBs
@@ -830,6 +1756,8 @@ bool DbncdMPBttn::updIsPressed(){
 				result = true;
 		}
 	}    
+	if(_fltrSmplsQty > 0)
+		result = _fltrGlitch(result);
 	_isPressed = result;
 
 	return _isPressed;
@@ -837,27 +1765,11 @@ bool DbncdMPBttn::updIsPressed(){
 
 unsigned long int DbncdMPBttn::_updTmrsMCDCalc(){
    /*returning values:
-      0: One of the input values was 0, or the MPBs list is empty: invalid result
-      Other: This value would make the MPBs update timer save resources */
-   unsigned long int MCD{0};
-	int auxPtr{0};
-	if(_mpbsInstncsLstPtr != nullptr){
-		// The list of MPBs to be updated is not empty, there's at least one MPB
-		while (*(_mpbsInstncsLstPtr + auxPtr) != nullptr){
+      0: No timer attached MPBs are listed: invalid result
+      Other: This value would make the MPBs update timer save resources
+	The value is kept updated by _addActvPrd() and _rmvActvPrd(), no list traversal is needed */
 
-			if ((*(_mpbsInstncsLstPtr + auxPtr))->getUpdTmrAttchd() == true){
-				if(MCD == 0){
-					MCD = (*(_mpbsInstncsLstPtr + auxPtr))->getPollPeriodMs();
-				}
-				else{
-					MCD = findMCD(MCD, (*(_mpbsInstncsLstPtr + auxPtr))->getPollPeriodMs());
-				}
-			}
-		++auxPtr;
-		}
-	}
-
-   return MCD;
+   return _actvPrdsMCD;
 }
 
 bool DbncdMPBttn::updValidPressesStatus(){
@@ -885,7 +1797,7 @@ bool DbncdMPBttn::updValidPressesStatus(){
 				_dbncRlsTimerStrt = millis();	//Started to be UNpressed
 			}
 			else{
-				if (((millis()) - _dbncRlsTimerStrt) >= (_dbncRlsTimeTempSett)){
+				if (((millis()) - _dbncRlsTimerStrt) >= (_dbncRlsTimeTempSett + _rlsDelay)){
 					_validReleasePend = true;
 					_prssRlsCcl = false;
 				}
@@ -896,6 +1808,42 @@ bool DbncdMPBttn::updValidPressesStatus(){
 	return (_validPressPend||_validReleasePend);
 }
 
+void DbncdMPBttn::_wrtOtptPins(const bool &frcWrt){
+	/*Writes the pins bound to the output attribute flags that changed since the last writing, invoked when the outputs change,
+	usually from the timer interrupt service*/
+	uint8_t otptsFlgs{0};
+	uint8_t chngdFlgs{0};
+	bool pinLvl{false};
+
+	_MpbCrtclSctnBgn();
+	otptsFlgs = (uint8_t)(_otptsSttsPkg() & ((1U << (IsOnScndryBitPos + 1)) - 1));
+	chngdFlgs = frcWrt ? 0xFF : (otptsFlgs ^ _otptPinsWrttn);
+	for(uint8_t bitPos{0}; (bitPos <= IsOnScndryBitPos) && (chngdFlgs != 0); bitPos++){
+		if(chngdFlgs & (1U << bitPos)){
+			chngdFlgs &= ~(1U << bitPos);
+			if(_otptPinsPtr[bitPos].pin != _InvalidPinNum){
+				pinLvl = (((otptsFlgs >> bitPos) & 0x01) != 0) == _otptPinsPtr[bitPos].actvHgh;
+				if(_otptPinsPtr[bitPos].otptBnk != nullptr)	// The bank image is modified, the chain is written at the end of the timer interrupt service
+					_otptPinsPtr[bitPos].otptBnk->_setOtptImgLvl(_otptPinsPtr[bitPos].pin, pinLvl);
+				else{
+#if defined(__AVR__)
+					if(pinLvl)
+						*_otptPinsPtr[bitPos].portReg |= _otptPinsPtr[bitPos].pinMsk;
+					else
+						*_otptPinsPtr[bitPos].portReg &= ~_otptPinsPtr[bitPos].pinMsk;
+#else
+					digitalWrite(_otptPinsPtr[bitPos].pin, pinLvl ? HIGH : LOW);
+#endif
+				}
+			}
+		}
+	}
+	_otptPinsWrttn = otptsFlgs;
+	_MpbCrtclSctnEnd();
+
+	return;
+}
+
 //=========================================================================> Class methods delimiter
 
 DbncdDlydMPBttn::DbncdDlydMPBttn()
@@ -919,6 +1867,26 @@ DbncdDlydMPBttn::~DbncdDlydMPBttn()
 {
 }
 
+void DbncdDlydMPBttn::_cfgPkg(uint8_t* &bufPtr){
+	DbncdMPBttn::_cfgPkg(bufPtr);
+	_cfgWrt(bufPtr, _strtDelay, 4);
+
+	return;
+}
+
+bool DbncdDlydMPBttn::_cfgUnpkg(const uint8_t* &bufPtr){
+	bool result{DbncdMPBttn::_cfgUnpkg(bufPtr)};
+
+	setStrtDelay(_cfgRd(bufPtr, 4));
+
+	return result;
+}
+
+uint8_t DbncdDlydMPBttn::_getCfgClsId(){
+
+	return 2;
+}
+
 bool DbncdDlydMPBttn::init(const uint8_t &mpbttnPin, const bool &pulledUp, const bool &typeNO, const unsigned long int &dbncTimeOrigSett, const unsigned long int &strtDelay){
 	bool result {false};
 
@@ -967,6 +1935,21 @@ bool LtchMPBttn::begin(const unsigned long int &pollDelayMs){
 	return result;
 }
 
+void LtchMPBttn::_cfgPkg(uint8_t* &bufPtr){
+	DbncdDlydMPBttn::_cfgPkg(bufPtr);
+	_cfgWrt(bufPtr, _trnOffASAP?0x01:0x00, 1);
+
+	return;
+}
+
+bool LtchMPBttn::_cfgUnpkg(const uint8_t* &bufPtr){
+	bool result{DbncdDlydMPBttn::_cfgUnpkg(bufPtr)};
+
+	setTrnOffASAP(_cfgRd(bufPtr, 1) & 0x01);
+
+	return result;
+}
+
 void LtchMPBttn::clrStatus(bool clrIsOn){
 	_isLatched = false;
 	_validUnlatchPend = false;
@@ -976,6 +1959,11 @@ void LtchMPBttn::clrStatus(bool clrIsOn){
 	return;
 }
 
+uint8_t LtchMPBttn::_getCfgClsId(){
+
+	return 10;
+}
+
 const bool LtchMPBttn::getIsLatched() const{
 
 	return _isLatched;
@@ -996,6 +1984,11 @@ const bool LtchMPBttn::getUnlatchRlsPend() const{
 	return _validUnlatchRlsPend;
 }
 
+bool LtchMPBttn::getUnltchSpprtd(){
+
+	return true;
+}
+
 void LtchMPBttn::mpbPollCallback(){
 
 	if(_mpbInstnc->getIsEnabled()){
@@ -1011,6 +2004,19 @@ void LtchMPBttn::mpbPollCallback(){
 	return;
 }
 
+void LtchMPBttn::_rstrSttsPkg(const uint32_t &sttsPkg){
+	// Restores a persisted On state as a latched On state, waiting for the unlatch
+	if(sttsPkg & (1UL << IsOnBitPos)){
+		if(!_isOn)
+			_turnOn();
+		_isLatched = true;
+		_mpbFdaState = stLtchNVUP;
+		setSttChng();
+	}
+
+	return;
+}
+
 void LtchMPBttn::setTrnOffASAP(const bool &newVal){
 	if(_trnOffASAP != newVal)
 		_trnOffASAP = newVal;
@@ -1035,7 +2041,7 @@ void LtchMPBttn::setUnlatchRlsPend(const bool &newVal){
 bool LtchMPBttn::unlatch(){
 	bool result{false};
 
-	if(_isLatched){
+	if(_isLatched || _isOn){	// An object turned On but not latched yet -i.e. still pressed- keeps the unlatch signals pending, and unlatches as soon as it latches
 		setUnlatchPend(true);
 		setUnlatchRlsPend(true);
 		result = true;
@@ -1049,7 +2055,7 @@ void LtchMPBttn::updFdaState(){
 		case stOffNotVPP:
 			//In: >>---------------------------------->>
 			if(_sttChng){
-				clrStatus(true);
+				LtchMPBttn::clrStatus(true);
 				stOffNotVPP_In();
 				clrSttChng();
 			}	// Execute this code only ONCE, when entering this state
@@ -1198,7 +2204,7 @@ void LtchMPBttn::updFdaState(){
 					else
 						_turnOn();
 				}
-				clrStatus(false);	//Clears all flags and timers, _isOn value will not be affected
+				LtchMPBttn::clrStatus(false);	//Clears all flags and timers, _isOn value will not be affected
 				stDisabled_In();
 				_validDisablePend = false;
 				_isEnabled = false;
@@ -1219,7 +2225,7 @@ void LtchMPBttn::updFdaState(){
 			}
 			//Out: >>---------------------------------->>
 			if(_sttChng){
-				clrStatus(true);
+				LtchMPBttn::clrStatus(true);
 				stDisabled_Out();
 			}	// Execute this code only ONCE, when exiting this state
 			break;
@@ -1289,6 +2295,8 @@ TmLtchMPBttn::TmLtchMPBttn(const uint8_t &mpbttnPin, const unsigned long int &ac
 {
 	if(_srvcTime < _MinSrvcTime)    //Best practice would impose failing the constructor (throwing an exception or building a "zombie" object)
 		_srvcTime = _MinSrvcTime;    //this tolerant approach taken for developers benefit, but object will be no faithful to the instantiation parameters
+	else if(_srvcTime > _MaxSrvcTime)
+		_srvcTime = _MaxSrvcTime;
 
 }
 
@@ -1301,26 +2309,72 @@ TmLtchMPBttn::TmLtchMPBttn(const TmLtchMPBttn &other)
 
 TmLtchMPBttn::~TmLtchMPBttn()
 {	
+	_dsrmTmr(_srvcTmr);
+}
+
+void TmLtchMPBttn::_armSrvcTmrs(){
+	// Arms the service timer with the deadline set by the _srvcTimerStrt
+	_armTmr(_srvcTmr, _srvcTimerStrt + _srvcTime);
+
+	return;
+}
+
+void TmLtchMPBttn::_cfgPkg(uint8_t* &bufPtr){
+	LtchMPBttn::_cfgPkg(bufPtr);
+	_cfgWrt(bufPtr, _srvcTime, 4);
+	_cfgWrt(bufPtr, _tmRstbl?0x01:0x00, 1);
+
+	return;
+}
+
+bool TmLtchMPBttn::_cfgUnpkg(const uint8_t* &bufPtr){
+	bool result{LtchMPBttn::_cfgUnpkg(bufPtr)};
+
+	if(!setSrvcTime(_cfgRd(bufPtr, 4)))
+		result = false;
+	setTmerRstbl(_cfgRd(bufPtr, 1) & 0x01);
+
+	return result;
 }
 
 void TmLtchMPBttn::clrStatus(bool clrIsOn){
 	_srvcTimerStrt = 0;
+	_dsrmSrvcTmrs();
 	LtchMPBttn::clrStatus(clrIsOn);
 
 	return;
 }
 
+void TmLtchMPBttn::_dsrmSrvcTmrs(){
+	_dsrmTmr(_srvcTmr);
+
+	return;
+}
+
+uint8_t TmLtchMPBttn::_getCfgClsId(){
+
+	return 3;
+}
+
 const unsigned long int TmLtchMPBttn::getSrvcTime() const{
 
 	return _srvcTime;
 }
 
+const unsigned long int TmLtchMPBttn::getSrvcTmRmnng() const{
+
+	return _getTmrRmnng(_srvcTmr);
+}
+
 bool TmLtchMPBttn::setSrvcTime(const unsigned long int &newSrvcTime){
 	bool result {true};
 
 	if (_srvcTime != newSrvcTime){
-		if (newSrvcTime >= _MinSrvcTime)  //The minimum activation time is _minActTime milliseconds
+		if ((newSrvcTime >= _MinSrvcTime) && (newSrvcTime <= _MaxSrvcTime)){  //The minimum activation time is _minActTime milliseconds, the maximum is limited by the timers signed deadlines comparison
 			_srvcTime = newSrvcTime;
+			if(_srvcTmr.armd)	// The running service time takes the new setting
+				_armSrvcTmrs();
+		}
 		else
 			result = false;
    }
@@ -1328,6 +2382,17 @@ bool TmLtchMPBttn::setSrvcTime(const unsigned long int &newSrvcTime){
    return result;
 }
 
+void TmLtchMPBttn::_rstrSttsPkg(const uint32_t &sttsPkg){
+	// The service time of a restored latched state is counted from the restoring
+	if(sttsPkg & (1UL << IsOnBitPos)){
+		_srvcTimerStrt = millis();
+		_armSrvcTmrs();
+	}
+	LtchMPBttn::_rstrSttsPkg(sttsPkg);
+
+	return;
+}
+
 void TmLtchMPBttn::setTmerRstbl(const bool &newIsRstbl){
 	if(_tmRstbl != newIsRstbl)
 		_tmRstbl = newIsRstbl;
@@ -1337,12 +2402,14 @@ void TmLtchMPBttn::setTmerRstbl(const bool &newIsRstbl){
 
 void TmLtchMPBttn::stOffNotVPP_Out(){
 	_srvcTimerStrt = 0;
+	_dsrmSrvcTmrs();
 
 	return;
 }
 
 void TmLtchMPBttn::stOffVPP_Out(){
 	_srvcTimerStrt = millis();
+	_armSrvcTmrs();
 
 	return;
 }
@@ -1350,11 +2417,13 @@ void TmLtchMPBttn::stOffVPP_Out(){
 void TmLtchMPBttn::updValidUnlatchStatus(){
 	if(_isLatched){
 		if(_validPressPend){
-			if(_tmRstbl)
+			if(_tmRstbl){
 				_srvcTimerStrt = millis();
+				_armSrvcTmrs();
+			}
 			_validPressPend = false;
 		}
-		if ((millis() - _srvcTimerStrt) >= _srvcTime){
+		if (_srvcTmr.expd){	// The service timer deadline was reached, no time calculation needed in each poll
 			_validUnlatchPend = true;
 			_validUnlatchRlsPend = true;
 		}
@@ -1390,10 +2459,40 @@ HntdTmLtchMPBttn::HntdTmLtchMPBttn(const HntdTmLtchMPBttn &other)
 	_validWrnngResetPend = other._validWrnngResetPend;
 	_validPilotSetPend = other._validPilotSetPend;
 	_validPilotResetPend = other._validPilotResetPend;
+	for(uint8_t stgIdx{0}; stgIdx < _WrnngStgsMax; stgIdx++){
+		_wrnngStgsPrctg[stgIdx] = other._wrnngStgsPrctg[stgIdx];
+		_fnWhnTrnOffWrnngStg[stgIdx] = other._fnWhnTrnOffWrnngStg[stgIdx];
+		_fnWhnTrnOnWrnngStg[stgIdx] = other._fnWhnTrnOnWrnngStg[stgIdx];
+	}
+	_wrnngStgsQty = other._wrnngStgsQty;
 }
 
 HntdTmLtchMPBttn::~HntdTmLtchMPBttn()
 {	
+	_dsrmTmr(_wrnngStgTmr);
+	_dsrmTmr(_wrnngTmr);
+}
+
+void HntdTmLtchMPBttn::_armSrvcTmrs(){
+	// The warning timer deadline is set _wrnngMs before the service timer deadline
+	TmLtchMPBttn::_armSrvcTmrs();
+	if(_wrnngPrctg > 0)
+		_armTmr(_wrnngTmr, _srvcTimerStrt + (_srvcTime - _wrnngMs));
+	else
+		_dsrmTmr(_wrnngTmr);
+	// The stages deadlines are calculated once per service time start, only the next stage to be reached keeps a timer armed
+	_wrnngStgRchd = 0;
+	for(uint8_t stgIdx{0}; stgIdx < _wrnngStgsQty; stgIdx++){
+		_wrnngStgsDdln[stgIdx] = _srvcTimerStrt + (_srvcTime - ((_srvcTime * _wrnngStgsPrctg[stgIdx]) / 100));
+		if((long)(millis() - _wrnngStgsDdln[stgIdx]) >= 0)	// Already passed stages, possible if re-armed by a settings change
+			_wrnngStgRchd = stgIdx + 1;
+	}
+	if(_wrnngStgRchd < _wrnngStgsQty)
+		_armTmr(_wrnngStgTmr, _wrnngStgsDdln[_wrnngStgRchd]);
+	else
+		_dsrmTmr(_wrnngStgTmr);
+
+	return;
 }
 
 bool HntdTmLtchMPBttn::begin(const unsigned long int &pollDelayMs){
@@ -1404,6 +2503,39 @@ bool HntdTmLtchMPBttn::begin(const unsigned long int &pollDelayMs){
 	return result;
 }
 
+void HntdTmLtchMPBttn::_cfgPkg(uint8_t* &bufPtr){
+	TmLtchMPBttn::_cfgPkg(bufPtr);
+	_cfgWrt(bufPtr, _wrnngPrctg, 1);
+	_cfgWrt(bufPtr, _keepPilot?0x01:0x00, 1);
+	_cfgWrt(bufPtr, _wrnngStgsQty, 1);
+	for(uint8_t stgIdx{0}; stgIdx < _WrnngStgsMax; stgIdx++)
+		_cfgWrt(bufPtr, _wrnngStgsPrctg[stgIdx], 1);
+
+	return;
+}
+
+bool HntdTmLtchMPBttn::_cfgUnpkg(const uint8_t* &bufPtr){
+	uint8_t wrnngPrctg{0};
+	uint8_t stgsPrctg[_WrnngStgsMax]{};
+	uint8_t stgsQty{0};
+	bool result{TmLtchMPBttn::_cfgUnpkg(bufPtr)};
+
+	wrnngPrctg = _cfgRd(bufPtr, 1);
+	if((wrnngPrctg != _wrnngPrctg) && !setWrnngPrctg(wrnngPrctg))	// setWrnngPrctg() returns false for an unchanged value too, a record applied again must not be rejected
+		result = false;
+	setKeepPilot(_cfgRd(bufPtr, 1) & 0x01);
+	stgsQty = _cfgRd(bufPtr, 1);
+	for(uint8_t stgIdx{0}; stgIdx < _WrnngStgsMax; stgIdx++)
+		stgsPrctg[stgIdx] = _cfgRd(bufPtr, 1);
+	if(!setWrnngStgs(stgsPrctg, stgsQty))
+		result = false;
+	_wrnngMs = (_srvcTime * _wrnngPrctg) / 100;	// The service time might have changed through the TmLtchMPBttn setter
+	if(_srvcTmr.armd)
+		_armSrvcTmrs();
+
+	return result;
+}
+
 void HntdTmLtchMPBttn::clrStatus(bool clrIsOn){
 	
 	//	Put here class specific sets/resets, including pilot and warning
@@ -1412,6 +2544,8 @@ void HntdTmLtchMPBttn::clrStatus(bool clrIsOn){
 	_wrnngOn = false; // Direct attribute flag unusual manipulation to avoid triggering Tasks and Functions responses
 	_validPilotSetPend = false;
 	_validPilotResetPend = false;
+	_wrnngStg = 0; // Direct attribute flag unusual manipulation to avoid triggering Tasks and Functions responses
+	_wrnngStgRchd = 0;
 	if(_keepPilot)
 		_pilotOn = true; // Direct attribute flag unusual manipulation to avoid triggering Tasks and Functions responses
 	else
@@ -1421,6 +2555,19 @@ void HntdTmLtchMPBttn::clrStatus(bool clrIsOn){
 	return;
 }
 
+void HntdTmLtchMPBttn::_dsrmSrvcTmrs(){
+	TmLtchMPBttn::_dsrmSrvcTmrs();
+	_dsrmTmr(_wrnngStgTmr);
+	_dsrmTmr(_wrnngTmr);
+
+	return;
+}
+
+uint8_t HntdTmLtchMPBttn::_getCfgClsId(){
+
+	return 4;
+}
+
 fncPtrType HntdTmLtchMPBttn::getFnWhnTrnOffPilot(){
 
 	return _fnWhnTrnOffPilot;
@@ -1431,6 +2578,15 @@ fncPtrType HntdTmLtchMPBttn::getFnWhnTrnOffWrnng(){
 	return _fnWhnTrnOffWrnng;
 }
 
+fncPtrType HntdTmLtchMPBttn::getFnWhnTrnOffWrnngStg(const uint8_t &stg){
+	fncPtrType result{nullptr};
+
+	if((stg > 0) && (stg <= _WrnngStgsMax))
+		result = _fnWhnTrnOffWrnngStg[stg - 1];
+
+	return result;
+}
+
 fncPtrType HntdTmLtchMPBttn::getFnWhnTrnOnPilot(){
 
 	return _fnWhnTrnOnPilot;
@@ -1441,6 +2597,15 @@ fncPtrType HntdTmLtchMPBttn::getFnWhnTrnOnWrnng(){
 	return _fnWhnTrnOnWrnng;
 }
 
+fncPtrType HntdTmLtchMPBttn::getFnWhnTrnOnWrnngStg(const uint8_t &stg){
+	fncPtrType result{nullptr};
+
+	if((stg > 0) && (stg <= _WrnngStgsMax))
+		result = _fnWhnTrnOnWrnngStg[stg - 1];
+
+	return result;
+}
+
 fncVdPtrPrmPtrType HntdTmLtchMPBttn::getFVPPWhnTrnOffPilot(){
 	
    return _fnVdPtrPrmWhnTrnOffPilot;
@@ -1491,14 +2656,30 @@ const bool HntdTmLtchMPBttn::getWrnngOn() const{
 	return _wrnngOn;
 }
 
-void HntdTmLtchMPBttn::mpbPollCallback(){
-	if(_mpbInstnc->getIsEnabled()){
-		// Input/Output signals update
-		updIsPressed();
+const uint8_t HntdTmLtchMPBttn::getWrnngStg() const{
+
+	return _wrnngStg;
+}
+
+const uint8_t HntdTmLtchMPBttn::getWrnngStgsQty() const{
+
+	return _wrnngStgsQty;
+}
+
+const unsigned long int HntdTmLtchMPBttn::getWrnngTmRmnng() const{
+
+	return _getTmrRmnng(_wrnngTmr);
+}
+
+void HntdTmLtchMPBttn::mpbPollCallback(){
+	if(_mpbInstnc->getIsEnabled()){
+		// Input/Output signals update
+		updIsPressed();
 		// Flags/Triggers calculation & update
 		updValidPressesStatus();
 		updValidUnlatchStatus();
 		updWrnngOn();
+		updWrnngStg();
 		updPilotOn();
 	}
  	// State machine state update
@@ -1521,6 +2702,8 @@ uint32_t HntdTmLtchMPBttn::_otptsSttsPkg(uint32_t prevVal){
 	else{
 		prevVal &= ~(((uint32_t)1) << WrnngOnBitPos);
 	}
+	prevVal &= ~(((uint32_t)0x07) << WrnngStgBitPos);
+	prevVal |= ((uint32_t)(_wrnngStg & 0x07)) << WrnngStgBitPos;
 
 	return prevVal;
 }
@@ -1539,6 +2722,18 @@ void HntdTmLtchMPBttn::setFnWhnTrnOffWrnngPtr(void(*newFnWhnTrnOff)()){
 	return;
 }
 
+bool HntdTmLtchMPBttn::setFnWhnTrnOffWrnngStgPtr(const uint8_t &stg, void(*newFnWhnTrnOff)()){
+	bool result{false};
+
+	if((stg > 0) && (stg <= _WrnngStgsMax)){
+		if (_fnWhnTrnOffWrnngStg[stg - 1] != newFnWhnTrnOff)
+			_fnWhnTrnOffWrnngStg[stg - 1] = newFnWhnTrnOff;
+		result = true;
+	}
+
+	return result;
+}
+
 void HntdTmLtchMPBttn::setFnWhnTrnOnPilotPtr(void(*newFnWhnTrnOn)()){
 	if (_fnWhnTrnOnPilot != newFnWhnTrnOn)
 		_fnWhnTrnOnPilot = newFnWhnTrnOn;
@@ -1553,6 +2748,18 @@ void HntdTmLtchMPBttn::setFnWhnTrnOnWrnngPtr(void(*newFnWhnTrnOn)()){
 	return;
 }
 
+bool HntdTmLtchMPBttn::setFnWhnTrnOnWrnngStgPtr(const uint8_t &stg, void(*newFnWhnTrnOn)()){
+	bool result{false};
+
+	if((stg > 0) && (stg <= _WrnngStgsMax)){
+		if (_fnWhnTrnOnWrnngStg[stg - 1] != newFnWhnTrnOn)
+			_fnWhnTrnOnWrnngStg[stg - 1] = newFnWhnTrnOn;
+		result = true;
+	}
+
+	return result;
+}
+
 void HntdTmLtchMPBttn::setFVPPWhnTrnOffPilot(fncVdPtrPrmPtrType newFVPPWhnTrnOff, void *argPtr){
 	if (_fnVdPtrPrmWhnTrnOffPilot != newFVPPWhnTrnOff){
 		_fnVdPtrPrmWhnTrnOffPilot = newFVPPWhnTrnOff;
@@ -1633,8 +2840,11 @@ bool HntdTmLtchMPBttn::setSrvcTime(const unsigned long int &newSrvcTime){
 
 	if (newSrvcTime != _srvcTime){
 		result = TmLtchMPBttn::setSrvcTime(newSrvcTime);
-		if (result)
+		if (result){
 			_wrnngMs = (_srvcTime * _wrnngPrctg) / 100;  //If the _srvcTime was changed, the _wrnngMs must be updated as it's a percentage of the first
+			if(_srvcTmr.armd)
+				_armSrvcTmrs();
+		}
 	}
 
 	return result;
@@ -1647,6 +2857,8 @@ bool HntdTmLtchMPBttn::setWrnngPrctg (const unsigned int &newWrnngPrctg){
 		if(newWrnngPrctg <= 100){
 			_wrnngPrctg = newWrnngPrctg;
 			_wrnngMs = (_srvcTime * _wrnngPrctg) / 100;
+			if(_srvcTmr.armd)
+				_armSrvcTmrs();
 			result = true;
 		}
 	}
@@ -1654,6 +2866,56 @@ bool HntdTmLtchMPBttn::setWrnngPrctg (const unsigned int &newWrnngPrctg){
 	return result;
 }
 
+bool HntdTmLtchMPBttn::setWrnngStgs(const uint8_t* prctgArr, const uint8_t &stgsQty){
+	bool result{true};
+
+	if(stgsQty > _WrnngStgsMax)
+		result = false;
+	else if(stgsQty > 0){
+		if(prctgArr == nullptr)
+			result = false;
+		else{
+			for(uint8_t stgIdx{0}; (stgIdx < stgsQty) && result; stgIdx++){
+				if((prctgArr[stgIdx] == 0) || (prctgArr[stgIdx] > 100))
+					result = false;
+				else if((stgIdx > 0) && (prctgArr[stgIdx] >= prctgArr[stgIdx - 1]))	// The stages must be ordered, each one closer to the expiration than the previous
+					result = false;
+			}
+		}
+	}
+	if(result){
+		_MpbCrtclSctnBgn();
+		for(uint8_t stgIdx{0}; stgIdx < stgsQty; stgIdx++)
+			_wrnngStgsPrctg[stgIdx] = prctgArr[stgIdx];
+		_wrnngStgsQty = stgsQty;
+		_MpbCrtclSctnEnd();
+		if(_srvcTmr.armd)
+			_armSrvcTmrs();
+		else
+			_dsrmTmr(_wrnngStgTmr);
+	}
+
+	return result;
+}
+
+void HntdTmLtchMPBttn::_setWrnngStg(const uint8_t &newStg){
+	//This method is invoked exclusively from the updFdaState, no need to declare it critical section
+	if(_wrnngStg != newStg){
+		//---------------->> Functions related actions
+		if((_wrnngStg > 0) && (_fnWhnTrnOffWrnngStg[_wrnngStg - 1] != nullptr)){
+			_fnWhnTrnOffWrnngStg[_wrnngStg - 1]();
+		}
+		if((newStg > 0) && (_fnWhnTrnOnWrnngStg[newStg - 1] != nullptr)){
+			_fnWhnTrnOnWrnngStg[newStg - 1]();
+		}
+		//---------------->> Flags related actions
+		_wrnngStg = newStg;
+		setOutputsChange(true);
+	}
+
+	return;
+}
+
 void HntdTmLtchMPBttn::stDisabled_In(){
 	//This method is invoked exclusively from the updFdaState, no need to declare it critical section
 	if(_validWrnngSetPend)
@@ -1663,6 +2925,7 @@ void HntdTmLtchMPBttn::stDisabled_In(){
 	if(_wrnngOn){
 		_turnOffWrnng();
 	}
+	_setWrnngStg(0);
 
 	if(_validPilotSetPend)
 		_validPilotSetPend = false;
@@ -1687,6 +2950,8 @@ void HntdTmLtchMPBttn::stLtchNVUP_Do(){
 		_turnOffWrnng();
 		_validWrnngResetPend = false;
 	}
+	if(_wrnngStg != _wrnngStgRchd)
+		_setWrnngStg(_wrnngStgRchd);
 
 	return;
 }
@@ -1701,6 +2966,7 @@ void HntdTmLtchMPBttn::stOffNotVPP_In(){
 	if(_wrnngOn){
 		_turnOffWrnng();
 	}
+	_setWrnngStg(0);
 
 	return;
 }
@@ -1725,6 +2991,8 @@ void HntdTmLtchMPBttn::stOnNVRP_Do(){
 		_turnOffWrnng();
 		_validWrnngResetPend = false;
 	}
+	if(_wrnngStg != _wrnngStgRchd)
+		_setWrnngStg(_wrnngStgRchd);
 
 	return;
 }
@@ -1821,7 +3089,7 @@ bool HntdTmLtchMPBttn::updPilotOn(){
 bool HntdTmLtchMPBttn::updWrnngOn(){
 	if(_wrnngPrctg > 0){
 		if (_isOn && _isEnabled){	//The _isEnabled evaluation is done to avoid computation of flags that will be ignored if the MPB is disablee
-			if ((millis() - _srvcTimerStrt) >= (_srvcTime - _wrnngMs)){
+			if (_wrnngTmr.expd){
 				if(_wrnngOn == false){
 					_validWrnngSetPend = true;
 					_validWrnngResetPend = false;
@@ -1841,6 +3109,22 @@ bool HntdTmLtchMPBttn::updWrnngOn(){
 	return _wrnngOn;
 }
 
+uint8_t HntdTmLtchMPBttn::updWrnngStg(){
+	// Only the flag of the single armed stage timer is checked, the cost doesn't depend on the number of stages configured
+	if(_wrnngStgTmr.expd){
+		_wrnngStgTmr.expd = false;
+		if(_isOn && _isEnabled && (_wrnngStgRchd < _wrnngStgsQty)){
+			_wrnngStgRchd++;
+			if(_wrnngStgRchd < _wrnngStgsQty)
+				_armTmr(_wrnngStgTmr, _wrnngStgsDdln[_wrnngStgRchd]);
+		}
+	}
+	if(!_isOn && (_wrnngStgRchd != 0))
+		_wrnngStgRchd = 0;
+
+	return _wrnngStgRchd;
+}
+
 //=========================================================================> Class methods delimiter
 
 XtrnUnltchMPBttn::XtrnUnltchMPBttn()
@@ -1859,13 +3143,22 @@ XtrnUnltchMPBttn::XtrnUnltchMPBttn(const uint8_t &mpbttnPin,
 {
 }
 
+XtrnUnltchMPBttn::XtrnUnltchMPBttn(const uint8_t &mpbttnPin, const uint8_t &unLtchPin,
+        const bool &pulledUp,  const bool &typeNO,  const unsigned long int &dbncTimeOrigSett,  const unsigned long int &strtDelay)
+:LtchMPBttn(mpbttnPin, pulledUp, typeNO, dbncTimeOrigSett, strtDelay)
+{
+	setUnltchPin(unLtchPin, pulledUp, typeNO, dbncTimeOrigSett);
+}
+
 bool XtrnUnltchMPBttn::begin(const unsigned long int &pollDelayMs){
    bool result {false};
 
+	if(_unLtchPin != _InvalidPinNum)
+		pinMode(_unLtchPin, (_unLtchPulledUp == true)?INPUT_PULLUP:INPUT);
 	result = LtchMPBttn::begin(pollDelayMs);
 
 	if (result){
-		if(_unLtchBttn != nullptr)
+		if((_unLtchPin == _InvalidPinNum) && (_unLtchBttn != nullptr))
 			result = _unLtchBttn->begin();
 		else
 			result = true;
@@ -1875,13 +3168,59 @@ bool XtrnUnltchMPBttn::begin(const unsigned long int &pollDelayMs){
 	return result;
 }
 
+void XtrnUnltchMPBttn::_cfgPkg(uint8_t* &bufPtr){
+	LtchMPBttn::_cfgPkg(bufPtr);
+	_cfgWrt(bufPtr, _unLtchDbncTime, 4);
+
+	return;
+}
+
+bool XtrnUnltchMPBttn::_cfgUnpkg(const uint8_t* &bufPtr){
+	unsigned long int unLtchDbncTm{0};
+	bool result{LtchMPBttn::_cfgUnpkg(bufPtr)};
+
+	unLtchDbncTm = _cfgRd(bufPtr, 4);
+	if(unLtchDbncTm != _unLtchDbncTime)	// The inline unlatch pin and it's wiring parameters are not part of the record
+		setUnltchPin(_unLtchPin, _unLtchPulledUp, _unLtchTypeNO, unLtchDbncTm);
+
+	return result;
+}
+
 void XtrnUnltchMPBttn::clrStatus(bool clrIsOn){
 	_xtrnUnltchPRlsCcl = false;
+	_unLtchDbncTmrStrt = 0;
+	_unLtchIsOn = false;	// The unlatch input level is debounced again from scratch, a stale level can't unlatch the cleared object
 	LtchMPBttn::clrStatus(clrIsOn);
 
 	return;
 }
 
+uint8_t XtrnUnltchMPBttn::_getCfgClsId(){
+
+	return 11;
+}
+
+bool XtrnUnltchMPBttn::getUnltchInptOn(){
+
+	return _unLtchIsOn;
+}
+
+uint8_t XtrnUnltchMPBttn::getUnltchPin(){
+
+	return _unLtchPin;
+}
+
+void XtrnUnltchMPBttn::setUnltchPin(const uint8_t &unLtchPin, const bool &pulledUp, const bool &typeNO, const unsigned long int &dbncTime){
+	_unLtchPin = unLtchPin;
+	_unLtchPulledUp = pulledUp;
+	_unLtchTypeNO = typeNO;
+	_unLtchDbncTime = (dbncTime < _stdMinDbncTime)?_stdMinDbncTime:dbncTime;
+	_unLtchDbncTmrStrt = 0;
+	_unLtchIsOn = false;
+
+	return;
+}
+
 void XtrnUnltchMPBttn::stOffNVURP_Do(){
 	if(_validDisablePend){
 		if(_validUnlatchRlsPend)
@@ -1895,14 +3234,44 @@ void XtrnUnltchMPBttn::stOffNVURP_Do(){
 	return;
 }
 
+void XtrnUnltchMPBttn::_updUnltchInpt(){
+	/*Embedded lightweight debouncer: the debounced level follows the input level
+	after it's kept stable for the _unLtchDbncTime, for both activation and deactivation*/
+	bool tmpInptOn {(digitalRead(_unLtchPin) == HIGH) != (_unLtchPulledUp == _unLtchTypeNO)};	// Same level logic as DbncdMPBttn::updIsPressed()
+
+	if(tmpInptOn != _unLtchIsOn){
+		if(_unLtchDbncTmrStrt == 0){
+			_unLtchDbncTmrStrt = millis();
+		}
+		else if((millis() - _unLtchDbncTmrStrt) >= _unLtchDbncTime){
+			_unLtchIsOn = tmpInptOn;
+			_unLtchDbncTmrStrt = 0;
+		}
+	}
+	else if(_unLtchDbncTmrStrt != 0){
+		_unLtchDbncTmrStrt = 0;
+	}
+
+	return;
+}
+
 void XtrnUnltchMPBttn::updValidUnlatchStatus(){
-	if(_unLtchBttn != nullptr){
+	bool unLtchOn {false};
+
+	if(_unLtchPin != _InvalidPinNum){
+		_updUnltchInpt();
+		unLtchOn = _unLtchIsOn;
+	}
+	else if(_unLtchBttn != nullptr){
+		unLtchOn = _unLtchBttn->getIsOn();
+	}
+	if((_unLtchPin != _InvalidPinNum) || (_unLtchBttn != nullptr)){
 		if(_isLatched){
-			if (_unLtchBttn->getIsOn() && !_xtrnUnltchPRlsCcl){
+			if (unLtchOn && !_xtrnUnltchPRlsCcl){
 				_validUnlatchPend = true;
 				_xtrnUnltchPRlsCcl = true;
 			}
-			if(!_unLtchBttn->getIsOn() && _xtrnUnltchPRlsCcl){
+			if(!unLtchOn && _xtrnUnltchPRlsCcl){
 				_validUnlatchRlsPend = true;
 				_xtrnUnltchPRlsCcl = false;
 			}
@@ -1929,6 +3298,7 @@ DblActnLtchMPBttn::DblActnLtchMPBttn(const uint8_t &mpbttnPin, const bool &pulle
 
 DblActnLtchMPBttn::~DblActnLtchMPBttn()
 {
+	_dsrmTmr(_scndModTmr);
 }
 
 bool DblActnLtchMPBttn::begin(const unsigned long int &pollDelayMs) {
@@ -1939,6 +3309,22 @@ bool DblActnLtchMPBttn::begin(const unsigned long int &pollDelayMs) {
 	return result;
 }
 
+void DblActnLtchMPBttn::_cfgPkg(uint8_t* &bufPtr){
+	LtchMPBttn::_cfgPkg(bufPtr);
+	_cfgWrt(bufPtr, _scndModActvDly, 4);
+
+	return;
+}
+
+bool DblActnLtchMPBttn::_cfgUnpkg(const uint8_t* &bufPtr){
+	bool result{LtchMPBttn::_cfgUnpkg(bufPtr)};
+
+	if(!setScndModActvDly(_cfgRd(bufPtr, 4)))
+		result = false;
+
+	return result;
+}
+
 void DblActnLtchMPBttn::clrStatus(bool clrIsOn){
 	_scndModTmrStrt = 0;
 	_validScndModPend = false;
@@ -1949,6 +3335,11 @@ void DblActnLtchMPBttn::clrStatus(bool clrIsOn){
 	return;
 }
 
+uint8_t DblActnLtchMPBttn::_getCfgClsId(){
+
+	return 5;
+}
+
 fncPtrType DblActnLtchMPBttn::getFnWhnTrnOffScndry(){
 
 	return _fnWhnTrnOffScndry;
@@ -1989,6 +3380,11 @@ unsigned long DblActnLtchMPBttn::getScndModActvDly(){
 	return _scndModActvDly;
 }
 
+bool DblActnLtchMPBttn::getUnltchSpprtd(){
+
+	return false;	// The state machine never latches, the main On state is only turned Off by a short press
+}
+
 void DblActnLtchMPBttn::mpbPollCallback(){
 	if(_mpbInstnc->getIsEnabled()){
 		// Input/Output signals update
@@ -2012,6 +3408,18 @@ uint32_t DblActnLtchMPBttn::_otptsSttsPkg(uint32_t prevVal){
 	return prevVal;
 }
 
+void DblActnLtchMPBttn::_rstrSttsPkg(const uint32_t &sttsPkg){
+	// Restores a persisted On state as the On state waiting for the next press, the secondary mode is not restored
+	if(sttsPkg & (1UL << IsOnBitPos)){
+		if(!_isOn)
+			_turnOn();
+		_mpbFdaState = stOnMPBRlsd;
+		setSttChng();
+	}
+
+	return;
+}
+
 void DblActnLtchMPBttn::setFnWhnTrnOffScndryPtr(void (*newFnWhnTrnOff)()){
 	if (_fnWhnTrnOffScndry != newFnWhnTrnOff){
 		_fnWhnTrnOffScndry = newFnWhnTrnOff;
@@ -2065,7 +3473,7 @@ bool DblActnLtchMPBttn::setScndModActvDly(const unsigned long &newVal){
 	bool result {true};
 
 	if(newVal != _scndModActvDly){
-		if (newVal >= _MinSrvcTime){  //The minimum activation time is _minActTime
+		if ((newVal >= _MinSrvcTime) && (newVal <= _MaxSrvcTime)){  //The minimum activation time is _minActTime
 			_scndModActvDly = newVal;
 		}
 		else{
@@ -2248,7 +3656,7 @@ void DblActnLtchMPBttn::updFdaState(){
 					else
 						_turnOnScndry();
 				}
-				clrStatus(false);	//Clears all flags and timers, _isOn value will not be affected
+				DblActnLtchMPBttn::clrStatus(false);	//Clears all flags and timers, _isOn value will not be affected
 				_isEnabled = false;
 				_validDisablePend = false;
 				setOutputsChange(true);
@@ -2271,7 +3679,7 @@ void DblActnLtchMPBttn::updFdaState(){
 
 			//Out: >>---------------------------------->>
 			if(_sttChng){
-				clrStatus(true);
+				DblActnLtchMPBttn::clrStatus(true);
 			}	// Execute this code only ONCE, when exiting this state
 			break;
 
@@ -2288,9 +3696,10 @@ bool DblActnLtchMPBttn::updValidPressesStatus(){
 			_dbncRlsTimerStrt = 0;
 		if(_dbncTimerStrt == 0){    //It was not previously pressed
 			_dbncTimerStrt = millis();	//Started to be pressed
+			_armTmr(_scndModTmr, _dbncTimerStrt + ((_dbncTimeTempSett + _strtDelay) + _scndModActvDly));
 		}
 		else{
-			if ((millis() - _dbncTimerStrt) >= ((_dbncTimeTempSett + _strtDelay) + _scndModActvDly)){
+			if (_scndModTmr.expd){
 				_validScndModPend = true;
 				_validPressPend = false;
 			} else if ((millis() - _dbncTimerStrt) >= (_dbncTimeTempSett + _strtDelay)){
@@ -2303,14 +3712,16 @@ bool DblActnLtchMPBttn::updValidPressesStatus(){
 		}
 	}
 	else{
-		if(_dbncTimerStrt != 0)
+		if(_dbncTimerStrt != 0){
 			_dbncTimerStrt = 0;
+			_dsrmTmr(_scndModTmr);
+		}
 		if(!_validReleasePend && _prssRlsCcl){
 			if(_dbncRlsTimerStrt == 0){    //It was not previously pressed
 				_dbncRlsTimerStrt = millis();	//Started to be UNpressed
 			}
 			else{
-				if ((millis() - _dbncRlsTimerStrt) >= (_dbncRlsTimeTempSett)){
+				if ((millis() - _dbncRlsTimerStrt) >= (_dbncRlsTimeTempSett + _rlsDelay)){
 					_validReleasePend = true;
 					_prssRlsCcl = false;
 				}
@@ -2372,20 +3783,106 @@ void DDlydDALtchMPBttn::stOnStrtScndMod_In(){
 
 //=========================================================================> Class methods delimiter
 
+// Embedded output mapping tables, 33 entries equally spaced in the [otptValMin, otptValMax] range
+static const uint8_t _otptMpEmbTblSz{33};
+static const uint16_t _otptMpLnrTbl[_otptMpEmbTblSz] PROGMEM = {
+	0, 2048, 4096, 6144, 8192, 10240, 12288, 14336, 16384, 18432, 20480, 22528, 24576, 26624, 28672, 30720,
+	32768, 34815, 36863, 38911, 40959, 43007, 45055, 47103, 49151, 51199, 53247, 55295, 57343, 59391, 61439, 63487,
+	65535
+};
+static const uint16_t _otptMpGmm22Tbl[_otptMpEmbTblSz] PROGMEM = {	// (x^2.2) * 65535
+	0, 32, 147, 359, 676, 1104, 1648, 2314, 3104, 4022, 5072, 6255, 7574, 9033, 10632, 12375,
+	14263, 16298, 18482, 20816, 23303, 25943, 28739, 31692, 34802, 38072, 41503, 45097, 48853, 52774, 56860, 61114,
+	65535
+};
+static const uint16_t _otptMpLogTbl[_otptMpEmbTblSz] PROGMEM = {	// ((1000^x - 1) / 999) * 65535
+	0, 16, 35, 60, 90, 127, 174, 232, 303, 392, 502, 639, 809, 1020, 1282, 1606,
+	2009, 2509, 3129, 3899, 4854, 6039, 7510, 9335, 11600, 14411, 17899, 22227, 27598, 34263, 42534, 52798,
+	65535
+};
+
 SldrDALtchMPBttn::SldrDALtchMPBttn()
 {	
+	_otptMpTblPtr = _otptMpLnrTbl;
+	_otptMpTblSz = _otptMpEmbTblSz;
+	_updOtptMppdVal();
 }
 
 SldrDALtchMPBttn::SldrDALtchMPBttn(const uint8_t &mpbttnPin, const bool &pulledUp, const bool &typeNO, const unsigned long int &dbncTimeOrigSett, const unsigned long int &strtDelay, const uint16_t initVal)
 :DblActnLtchMPBttn(mpbttnPin, pulledUp, typeNO, dbncTimeOrigSett, strtDelay), _initOtptCurVal{initVal}
 {
 	_otptCurVal = _initOtptCurVal;
+	_otptMpTblPtr = _otptMpLnrTbl;
+	_otptMpTblSz = _otptMpEmbTblSz;
+	_updOtptMppdVal();
 }
 
 SldrDALtchMPBttn::~SldrDALtchMPBttn()
 {
 }
 
+void SldrDALtchMPBttn::_cfgPkg(uint8_t* &bufPtr){
+	DblActnLtchMPBttn::_cfgPkg(bufPtr);
+	_cfgWrt(bufPtr, _otptValMin, 2);
+	_cfgWrt(bufPtr, _otptValMax, 2);
+	_cfgWrt(bufPtr, _otptSldrSpd, 2);
+	_cfgWrt(bufPtr, _otptSldrStpSize, 2);
+	_cfgWrt(bufPtr, (_autoSwpDirOnEnd?0x01:0x00) | (_autoSwpDirOnPrss?0x02:0x00), 1);
+	_cfgWrt(bufPtr, _otptMp, 1);
+	_cfgWrt(bufPtr, _sldrAccl, 1);
+	_cfgWrt(bufPtr, _sldrAcclTm, 4);
+	_cfgWrt(bufPtr, _sldrAcclMax, 1);
+
+	return;
+}
+
+bool SldrDALtchMPBttn::_cfgUnpkg(const uint8_t* &bufPtr){
+	uint16_t valMin{0};
+	uint16_t valMax{0};
+	uint16_t sldrSpd{0};
+	uint16_t sldrStpSize{0};
+	uint8_t cfgFlgs{0};
+	uint8_t otptMp{0};
+	uint8_t sldrAccl{0};
+	unsigned long sldrAcclTm{0};
+	uint8_t sldrAcclMax{0};
+	bool result{DblActnLtchMPBttn::_cfgUnpkg(bufPtr)};
+
+	valMin = _cfgRd(bufPtr, 2);
+	valMax = _cfgRd(bufPtr, 2);
+	sldrSpd = _cfgRd(bufPtr, 2);
+	sldrStpSize = _cfgRd(bufPtr, 2);
+	cfgFlgs = _cfgRd(bufPtr, 1);
+	otptMp = _cfgRd(bufPtr, 1);
+	sldrAccl = _cfgRd(bufPtr, 1);
+	sldrAcclTm = _cfgRd(bufPtr, 4);
+	sldrAcclMax = _cfgRd(bufPtr, 1);
+	if(valMax > _otptValMin){	// The limits are set in the order that keeps the valMin < valMax condition
+		if(!setOtptValMax(valMax))
+			result = false;
+		if(!setOtptValMin(valMin))
+			result = false;
+	}
+	else{
+		if(!setOtptValMin(valMin))
+			result = false;
+		if(!setOtptValMax(valMax))
+			result = false;
+	}
+	if(!setOtptSldrSpd(sldrSpd))
+		result = false;
+	if(!setOtptSldrStpSize(sldrStpSize))
+		result = false;
+	setSwpDirOnEnd(cfgFlgs & 0x01);
+	setSwpDirOnPrss(cfgFlgs & 0x02);
+	if((otptMp != OtptMpCstm) && !setOtptMp(otptMp))	// The custom table and acceleration table pointers are not part of the record
+		result = false;
+	if((sldrAccl != SldrAcclTbl) && !setSldrAccl(sldrAccl, sldrAcclTm, sldrAcclMax))
+		result = false;
+
+	return result;
+}
+
 void SldrDALtchMPBttn::clrStatus(bool clrIsOn){
 	// Might the option to return the _otpCurVal to the initVal be added? To one the extreme values?
 	if(clrIsOn && _isOnScndry)
@@ -2395,6 +3892,11 @@ void SldrDALtchMPBttn::clrStatus(bool clrIsOn){
 	return;
 }
 
+uint8_t SldrDALtchMPBttn::_getCfgClsId(){
+
+	return 6;
+}
+
 fncPtrType SldrDALtchMPBttn::getFnWhnTrnOffSldrDirUp(){
    
 	return _fnWhnTrnOffSldrDirUp;
@@ -2502,6 +4004,26 @@ bool SldrDALtchMPBttn::getOtptCurValIsMin(){
 	return _otptCurValIsMin;
 }
 
+uint8_t SldrDALtchMPBttn::getOtptMp(){
+
+	return _otptMp;
+}
+
+uint16_t SldrDALtchMPBttn::getOtptMppdVal(){
+	uint16_t result{0};
+
+	_MpbCrtclSctnBgn();
+	result = _otptMppdVal;
+	_MpbCrtclSctnEnd();
+
+	return result;
+}
+
+uint8_t SldrDALtchMPBttn::getOtptPwmPin(){
+
+	return _otptPwmPin;
+}
+
 unsigned long SldrDALtchMPBttn::getOtptSldrSpd(){
 
 	return _otptSldrSpd;
@@ -2522,6 +4044,11 @@ uint16_t SldrDALtchMPBttn::getOtptValMin(){
 	return _otptValMin;
 }
 
+uint8_t SldrDALtchMPBttn::getSldrAccl(){
+
+	return _sldrAccl;
+}
+
 bool SldrDALtchMPBttn::getSldrDirUp(){
 
 	return _curSldrDirUp;
@@ -2552,6 +4079,36 @@ uint32_t SldrDALtchMPBttn::_otptsSttsPkg(uint32_t prevVal){
 	return prevVal;
 }
 
+void SldrDALtchMPBttn::_rstSldrRt(){
+	_sldrRtSgmntStrt = _scndModTmrStrt;
+	_sldrRtSgmntBs = _sldrBsRt;
+	_sldrRtSlp = _sldrRtSlpBs;
+	_sldrAcclTblIdx = 0;
+	if(_sldrAccl == SldrAcclTbl)
+		_sldrRt = (_sldrBsRt * _sldrAcclTblPtr[0]) >> 8;
+	else
+		_sldrRt = _sldrBsRt;
+
+	return;
+}
+
+void SldrDALtchMPBttn::_rstrSttsPkg(const uint32_t &sttsPkg){
+	uint16_t rstrdVal{(uint16_t)(sttsPkg >> OtptCurValBitPos)};
+
+	if(rstrdVal < _otptValMin)
+		rstrdVal = _otptValMin;
+	else if(rstrdVal > _otptValMax)
+		rstrdVal = _otptValMax;
+	if(_otptCurVal != rstrdVal){
+		_otptCurVal = rstrdVal;
+		_updOtptMppdVal();
+		setOutputsChange(true);
+	}
+	DblActnLtchMPBttn::_rstrSttsPkg(sttsPkg);
+
+	return;
+}
+
 void SldrDALtchMPBttn::setFnWhnTrnOffSldrDirUp(void (*newFnWhnTrnOff)()){
 	if(_fnWhnTrnOffSldrDirUp != newFnWhnTrnOff)
 		_fnWhnTrnOffSldrDirUp = newFnWhnTrnOff;
@@ -2694,8 +4251,12 @@ bool SldrDALtchMPBttn::setOtptCurVal(const uint16_t &newVal){
 	bool result{true};
 
 	if(_otptCurVal != newVal){
-		if(newVal >= _otptValMin && newVal <= _otptValMax)
+		if(newVal >= _otptValMin && newVal <= _otptValMax){
+			_MpbCrtclSctnBgn();
 			_otptCurVal = newVal;
+			_updOtptMppdVal();
+			_MpbCrtclSctnEnd();
+		}
 		else
 			result = false;
 	}
@@ -2703,12 +4264,103 @@ bool SldrDALtchMPBttn::setOtptCurVal(const uint16_t &newVal){
 	return result;
 }
 
+bool SldrDALtchMPBttn::setOtptMp(const uint8_t &newMp){
+	bool result{true};
+	const uint16_t* tblPtr{nullptr};
+
+	if(newMp == OtptMpLnr)
+		tblPtr = _otptMpLnrTbl;
+	else if(newMp == OtptMpGmm22)
+		tblPtr = _otptMpGmm22Tbl;
+	else if(newMp == OtptMpLog)
+		tblPtr = _otptMpLogTbl;
+	else
+		result = false;
+	if(result){
+		_MpbCrtclSctnBgn();
+		_otptMp = newMp;
+		_otptMpTblPtr = tblPtr;
+		_otptMpTblSz = _otptMpEmbTblSz;
+		_updOtptMppdVal();
+		_MpbCrtclSctnEnd();
+	}
+
+	return result;
+}
+
+bool SldrDALtchMPBttn::setOtptMpTbl(const uint16_t* tblPtr, const uint8_t &tblSz){
+	bool result{false};
+
+	if((tblPtr != nullptr) && (tblSz > 1)){
+		_MpbCrtclSctnBgn();
+		_otptMp = OtptMpCstm;
+		_otptMpTblPtr = tblPtr;
+		_otptMpTblSz = tblSz;
+		_updOtptMppdVal();
+		_MpbCrtclSctnEnd();
+		result = true;
+	}
+
+	return result;
+}
+
+bool SldrDALtchMPBttn::setOtptPwmOcr(volatile uint16_t* ocrPtr, const uint16_t &ocrTop){
+	bool result{false};
+
+	if((ocrPtr == nullptr) || (ocrTop > 0)){
+		_MpbCrtclSctnBgn();
+		_otptPwmPin = _InvalidPinNum;
+		_otptPwmOcrPtr = ocrPtr;
+		_otptPwmOcrTop = ocrTop;
+		_wrtOtptPwm();
+		_MpbCrtclSctnEnd();
+		result = true;
+	}
+
+	return result;
+}
+
+bool SldrDALtchMPBttn::setOtptPwmPin(const uint8_t &pwmPin, const uint8_t &pwmRes){
+	bool result{true};
+
+	if(pwmPin != _InvalidPinNum){
+		if((pwmRes < 1) || (pwmRes > 16))
+			result = false;
+#ifdef __AVR__
+		else if(pwmRes != 8)	// The AVR cores analogWrite() duty cycle is fixed to 8 bits, wider values would be truncated by the 8 bits OCR registers
+			result = false;
+		else{
+			uint8_t pwmTmr{digitalPinToTimer(pwmPin)};
+			if((pwmTmr == NOT_ON_TIMER) || (pwmTmr == TIMER1A) || (pwmTmr == TIMER1B) || (pwmTmr == TIMER1C))	// Timer1 is reserved for the MPBs refresh timer callback
+				result = false;
+		}
+#endif
+	}
+	if(result){
+		if(pwmPin != _InvalidPinNum)
+			pinMode(pwmPin, OUTPUT);
+		_MpbCrtclSctnBgn();
+		_otptPwmOcrPtr = nullptr;
+		_otptPwmPin = pwmPin;
+		_otptPwmRes = pwmRes;
+		_wrtOtptPwm();
+		_MpbCrtclSctnEnd();
+	}
+
+	return result;
+}
+
 bool SldrDALtchMPBttn::setOtptSldrSpd(const uint16_t &newVal){
 	bool result{true};
 
 	if(newVal != _otptSldrSpd){
-		if(newVal > 0)
+		if(newVal > 0){
+			_MpbCrtclSctnBgn();
 			_otptSldrSpd = newVal;
+			_sldrBsRt = 0x10000UL / newVal;	// The only division of the slider rate calculations, the timer callback just adds the rate
+			_updSldrRtPrms();
+			_MpbCrtclSctnEnd();
+		}
 		else
 			result = false;
 	}
@@ -2731,14 +4383,20 @@ bool SldrDALtchMPBttn::setOtptSldrStpSize(const uint16_t &newVal){
 
 bool SldrDALtchMPBttn::setOtptValMax(const uint16_t &newVal){
 	bool result{true};
+	bool otptCurValChng{false};
 
 	if(newVal != _otptValMax){
 		if(newVal > _otptValMin){
+			_MpbCrtclSctnBgn();
 			_otptValMax = newVal;
 			if(_otptCurVal > _otptValMax){
 				_otptCurVal = _otptValMax;
-				setOutputsChange(true);
+				otptCurValChng = true;
 			}
+			_updOtptMppdVal();	// The range changed, the mapped value must be recalculated even if the otptCurVal didn't change
+			_MpbCrtclSctnEnd();
+			if(otptCurValChng)
+				setOutputsChange(true);
 		}
 		else{
 			result = false;
@@ -2750,14 +4408,20 @@ bool SldrDALtchMPBttn::setOtptValMax(const uint16_t &newVal){
 
 bool SldrDALtchMPBttn::setOtptValMin(const uint16_t &newVal){
 	bool result{true};
+	bool otptCurValChng{false};
 
 	if(newVal != _otptValMin){
 		if(newVal < _otptValMax){
+			_MpbCrtclSctnBgn();
 			_otptValMin = newVal;
 			if(_otptCurVal < _otptValMin){
 				_otptCurVal = _otptValMin;
-				setOutputsChange(true);
+				otptCurValChng = true;
 			}
+			_updOtptMppdVal();
+			_MpbCrtclSctnEnd();
+			if(otptCurValChng)
+				setOutputsChange(true);
 		}
 		else{
 			result = false;
@@ -2767,6 +4431,44 @@ bool SldrDALtchMPBttn::setOtptValMin(const uint16_t &newVal){
 	return result;
 }
 
+bool SldrDALtchMPBttn::setSldrAccl(const uint8_t &crv, const unsigned long &acclTm, const uint8_t &acclMax){
+	bool result{false};
+
+	if(crv == SldrAcclNone)
+		result = true;
+	else if(((crv == SldrAcclLnr) || (crv == SldrAcclExp)) && (acclTm > 0) && (acclMax > 1))
+		result = true;
+	if(result){
+		_MpbCrtclSctnBgn();
+		_sldrAccl = crv;
+		if(crv != SldrAcclNone){
+			_sldrAcclTm = acclTm;
+			_sldrAcclMax = acclMax;
+		}
+		_updSldrRtPrms();
+		_MpbCrtclSctnEnd();
+	}
+
+	return result;
+}
+
+bool SldrDALtchMPBttn::setSldrAcclTbl(const uint16_t* tblPtr, const uint8_t &tblSz, const unsigned long &stpTm){
+	bool result{false};
+
+	if((tblPtr != nullptr) && (tblSz > 0) && (stpTm > 0)){
+		_MpbCrtclSctnBgn();
+		_sldrAccl = SldrAcclTbl;
+		_sldrAcclTblPtr = tblPtr;
+		_sldrAcclTblSz = tblSz;
+		_sldrAcclTm = stpTm;
+		_updSldrRtPrms();
+		_MpbCrtclSctnEnd();
+		result = true;
+	}
+
+	return result;
+}
+
 bool SldrDALtchMPBttn::_setSldrDir(const bool &newVal){
 	bool result{true};
 
@@ -2825,24 +4527,36 @@ void SldrDALtchMPBttn::stOnEndScndMod_Out(){
 void SldrDALtchMPBttn::stOnScndMod_Do(){
 	// Operating in Slider mode, change the associated value according to the time elapsed since last update
 	//and the step size for every time unit elapsed
-	uint16_t _otpStpsChng{0};
-	unsigned long _sldrTmrNxtStrt{0};
-	unsigned long _sldrTmrRemains{0};
-
-	_sldrTmrNxtStrt = millis();
-	_otpStpsChng = (_sldrTmrNxtStrt - _scndModTmrStrt) /_otptSldrSpd;
-	_sldrTmrRemains = ((_sldrTmrNxtStrt - _scndModTmrStrt) % _otptSldrSpd) * _otptSldrSpd;
-	_sldrTmrNxtStrt -= _sldrTmrRemains;
-	_scndModTmrStrt = _sldrTmrNxtStrt;	//This ends the time management section of the state, calculating the time
+	unsigned long curTm{millis()};
+	unsigned long elpsdTm{curTm - _scndModTmrStrt};
+	uint32_t otptStpsChng{0};
+	uint32_t otptValChng{0};
+
+	_scndModTmrStrt = curTm;
+	if(_sldrAccl != SldrAcclNone)
+		_updSldrRt(curTm);
+	if(elpsdTm <= 0xFF){	// The rate is always < 2^24, so the product and the fractional steps kept fit in the 32 bits accumulator
+		_sldrStpsAcc += elpsdTm * _sldrRt;
+	}
+	else{	// Long lapse since the last update, saturate the accumulator instead of overflowing it
+		uint64_t stpsAcc{((uint64_t)elpsdTm * _sldrRt) + _sldrStpsAcc};
+		_sldrStpsAcc = (stpsAcc > 0xFFFFFFFFULL)?0xFFFFFFFFUL:(uint32_t)stpsAcc;
+	}
+	otptStpsChng = _sldrStpsAcc >> 16;
+	_sldrStpsAcc &= 0xFFFF;	//This ends the time management section of the state, the fractional steps are kept for the next update
+	if(otptStpsChng > 0xFFFF)
+		otptStpsChng = 0xFFFF;
+	otptValChng = otptStpsChng * _otptSldrStpSize;
 
 	if(_curSldrDirUp){	// The slider is moving up		
-		if(_otptCurVal != _otptValMax){
-			if((_otptValMax - _otptCurVal) >= (_otpStpsChng * _otptSldrStpSize)){	//The value change is in range				
-				_otptCurVal += (_otpStpsChng * _otptSldrStpSize);
+		if((otptValChng > 0) && (_otptCurVal != _otptValMax)){
+			if((uint32_t)(_otptValMax - _otptCurVal) >= otptValChng){	//The value change is in range				
+				_otptCurVal += otptValChng;
 			}
 			else{	//The value change goes out of range				
 				_otptCurVal = _otptValMax;
 			}
+			_updOtptMppdVal();
 			setOutputsChange(true);
 		}
 		if(getOutputsChange()){
@@ -2858,13 +4572,14 @@ void SldrDALtchMPBttn::stOnScndMod_Do(){
 		}
 	}
 	else{	// The slider is moving down		
-		if(_otptCurVal != _otptValMin){
-			if((_otptCurVal - _otptValMin) >= (_otpStpsChng * _otptSldrStpSize)){	//The value change is in range				
-				_otptCurVal -= (_otpStpsChng * _otptSldrStpSize);
+		if((otptValChng > 0) && (_otptCurVal != _otptValMin)){
+			if((uint32_t)(_otptCurVal - _otptValMin) >= otptValChng){	//The value change is in range				
+				_otptCurVal -= otptValChng;
 			}
 			else{	//The value change goes out of range				
 				_otptCurVal = _otptValMin;
 			}
+			_updOtptMppdVal();
 			setOutputsChange(true);
 		}
 		if(getOutputsChange()){
@@ -2886,6 +4601,8 @@ void SldrDALtchMPBttn::stOnScndMod_Do(){
 void SldrDALtchMPBttn::stOnStrtScndMod_In(){
 	if(!_isOnScndry)
 		_turnOnScndry();
+	_sldrStpsAcc = 0;
+	_rstSldrRt();
 	if(_autoSwpDirOnPrss)
 		swapSldrDir();
 
@@ -2973,31 +4690,149 @@ void SldrDALtchMPBttn::_turnOnSldrMin(){
 	return;
 }
 
-//=========================================================================> Class methods delimiter
-
-VdblMPBttn::VdblMPBttn()
-{
-}
+void SldrDALtchMPBttn::_updOtptMppdVal(){
+	// Invoked only when the otptCurVal, the range or the mapping table change, the interpolation position is a 8 bits fixed point fraction between two table entries
+	uint32_t tblPos{0};
+	uint8_t tblIdx{0};
+	uint16_t tblFrc{0};
+	uint16_t lwrVal{0};
+	uint16_t uprVal{0};
+
+	if(_otptMpTblPtr != nullptr){
+		if(_otptValMax > _otptValMin)
+			tblPos = ((((uint32_t)(_otptCurVal - _otptValMin)) * (_otptMpTblSz - 1)) << 8) / (uint32_t)(_otptValMax - _otptValMin);
+		tblIdx = tblPos >> 8;
+		tblFrc = tblPos & 0xFF;
+		lwrVal = pgm_read_word(_otptMpTblPtr + tblIdx);
+		if(tblFrc > 0){
+			uprVal = pgm_read_word(_otptMpTblPtr + tblIdx + 1);
+			_otptMppdVal = (uint16_t)((int32_t)lwrVal + ((((int32_t)uprVal - (int32_t)lwrVal) * tblFrc) >> 8));
+		}
+		else
+			_otptMppdVal = lwrVal;
+		_wrtOtptPwm();
+	}
 
-VdblMPBttn::VdblMPBttn(const uint8_t &mpbttnPin, const bool &pulledUp, const bool &typeNO, const unsigned long int &dbncTimeOrigSett, const unsigned long int &strtDelay, const bool &isOnDisabled)
-:DbncdDlydMPBttn(mpbttnPin, pulledUp, typeNO, dbncTimeOrigSett, strtDelay)
-{
-	_isOnDisabled = isOnDisabled;
+	return;
 }
 
-VdblMPBttn::~VdblMPBttn()
-{
-}
+void SldrDALtchMPBttn::_updSldrRt(const unsigned long &curTm){
+	// Acceleration curves rate update, no divisions are needed as the slopes were precalculated by _updSldrRtPrms()
+	unsigned long sgmntTm{curTm - _sldrRtSgmntStrt};
 
-void VdblMPBttn::clrStatus(bool clrIsOn){
-	if(_isVoided){
-		setIsNotVoided();
+	if(_sldrAccl == SldrAcclLnr){
+		if(_sldrRt < _sldrRtMax){
+			if(sgmntTm < _sldrAcclTm)
+				_sldrRt = _sldrRtSgmntBs + (_sldrRtSlp * sgmntTm);
+			else
+				_sldrRt = _sldrRtMax;
+		}
+	}
+	else if(_sldrAccl == SldrAcclExp){
+		if(_sldrRt < _sldrRtMax){
+			while((sgmntTm >= _sldrAcclTm) && (_sldrRtSgmntBs < _sldrRtMax)){	// Each segment doubles the rate and the slope of the previous one
+				_sldrRtSgmntBs <<= 1;
+				_sldrRtSlp <<= 1;
+				_sldrRtSgmntStrt += _sldrAcclTm;
+				sgmntTm -= _sldrAcclTm;
+			}
+			if(_sldrRtSgmntBs < _sldrRtMax){
+				_sldrRt = _sldrRtSgmntBs + (_sldrRtSlp * sgmntTm);
+				if(_sldrRt > _sldrRtMax)
+					_sldrRt = _sldrRtMax;
+			}
+			else
+				_sldrRt = _sldrRtMax;
+		}
+	}
+	else if(_sldrAccl == SldrAcclTbl){
+		if((_sldrAcclTblIdx < (_sldrAcclTblSz - 1)) && (sgmntTm >= _sldrAcclTm)){
+			do{
+				++_sldrAcclTblIdx;
+				_sldrRtSgmntStrt += _sldrAcclTm;
+				sgmntTm -= _sldrAcclTm;
+			}while((_sldrAcclTblIdx < (_sldrAcclTblSz - 1)) && (sgmntTm >= _sldrAcclTm));
+			_sldrRt = (_sldrBsRt * _sldrAcclTblPtr[_sldrAcclTblIdx]) >> 8;
+		}
 	}
-	DbncdMPBttn::clrStatus(clrIsOn);
 
 	return;
 }
 
+void SldrDALtchMPBttn::_updSldrRtPrms(){
+	// Precalculates the acceleration curves parameters, invoked from the setters only, never from the timer callback
+	_sldrRtMax = _sldrBsRt;
+	_sldrRtSlpBs = 0;
+	if((_sldrAccl == SldrAcclLnr) || (_sldrAccl == SldrAcclExp)){
+		_sldrRtMax = _sldrBsRt * _sldrAcclMax;
+		if(_sldrAccl == SldrAcclLnr)
+			_sldrRtSlpBs = (_sldrRtMax - _sldrBsRt) / _sldrAcclTm;
+		else
+			_sldrRtSlpBs = _sldrBsRt / _sldrAcclTm;
+	}
+	_rstSldrRt();
+
+	return;
+}
+
+void SldrDALtchMPBttn::_wrtOtptPwm(){
+	// Invoked from _updOtptMppdVal(), so the bound output is written only when the output mapped value changes
+	if(_otptPwmOcrPtr != nullptr)
+		*_otptPwmOcrPtr = (uint16_t)((((uint32_t)_otptMppdVal) * ((uint32_t)_otptPwmOcrTop + 1)) >> 16);
+	else if(_otptPwmPin != _InvalidPinNum)
+		analogWrite(_otptPwmPin, _otptMppdVal >> (16 - _otptPwmRes));
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+VdblMPBttn::VdblMPBttn()
+{
+}
+
+VdblMPBttn::VdblMPBttn(const uint8_t &mpbttnPin, const bool &pulledUp, const bool &typeNO, const unsigned long int &dbncTimeOrigSett, const unsigned long int &strtDelay, const bool &isOnDisabled)
+:DbncdDlydMPBttn(mpbttnPin, pulledUp, typeNO, dbncTimeOrigSett, strtDelay)
+{
+	_isOnDisabled = isOnDisabled;
+}
+
+VdblMPBttn::~VdblMPBttn()
+{
+}
+
+void VdblMPBttn::_cfgPkg(uint8_t* &bufPtr){
+	DbncdDlydMPBttn::_cfgPkg(bufPtr);
+	_cfgWrt(bufPtr, (_frcOtptLvlWhnVdd?0x01:0x00) | (_stOnWhnOtptFrcd?0x02:0x00), 1);
+
+	return;
+}
+
+bool VdblMPBttn::_cfgUnpkg(const uint8_t* &bufPtr){
+	uint8_t cfgFlgs{0};
+	bool result{DbncdDlydMPBttn::_cfgUnpkg(bufPtr)};
+
+	cfgFlgs = _cfgRd(bufPtr, 1);
+	setFrcdOtptWhnVdd(cfgFlgs & 0x01);
+	setStOnWhnOtpFrcd(cfgFlgs & 0x02);
+
+	return result;
+}
+
+void VdblMPBttn::clrStatus(bool clrIsOn){
+	if(_isVoided){
+		setIsNotVoided();
+	}
+	DbncdMPBttn::clrStatus(clrIsOn);
+
+	return;
+}
+
+uint8_t VdblMPBttn::_getCfgClsId(){
+
+	return 7;
+}
+
 fncPtrType VdblMPBttn::getFnWhnTrnOffVdd(){
 
 	return _fnWhnTrnOffVdd;
@@ -3068,6 +4903,19 @@ uint32_t VdblMPBttn::_otptsSttsPkg(uint32_t prevVal){
 	return prevVal;
 }
 
+void VdblMPBttn::_rstrSttsPkg(const uint32_t &sttsPkg){
+	// Restores a persisted voided state as the voided state waiting for the unvoiding conditions
+	if(sttsPkg & (1UL << IsVoidedBitPos)){
+		if(_isOn)
+			_turnOff();
+		_turnOnVdd();
+		_mpbFdaState = stOffVddNVUP;
+		setSttChng();
+	}
+
+	return;
+}
+
 void VdblMPBttn::setFnWhnTrnOffVddPtr(void(*newFnWhnTrnOff)()){
 	if (_fnWhnTrnOffVdd != newFnWhnTrnOff)
 		_fnWhnTrnOffVdd = newFnWhnTrnOff;
@@ -3156,13 +5004,13 @@ void VdblMPBttn::stDisabled_In(){
 		else
 			_turnOn();
 	}
-	clrStatus(false);	//Clears all flags and timers, _isOn value will not be affected
+	VdblMPBttn::clrStatus(false);	//Clears all flags and timers, _isOn value will not be affected
 
 	return;
 }
 
 void VdblMPBttn::stDisabled_Out(){
-	clrStatus(true);	//Clears all flags and timers, _isOn value **will** be reset
+	VdblMPBttn::clrStatus(true);	//Clears all flags and timers, _isOn value **will** be reset
 
 	return;
 }
@@ -3392,10 +5240,13 @@ TmVdblMPBttn::TmVdblMPBttn()
 TmVdblMPBttn::TmVdblMPBttn(const uint8_t &mpbttnPin, unsigned long int voidTime, const bool &pulledUp, const bool &typeNO, const unsigned long int &dbncTimeOrigSett, const unsigned long int &strtDelay, const bool &isOnDisabled)
 :VdblMPBttn(mpbttnPin, pulledUp, typeNO, dbncTimeOrigSett, strtDelay, isOnDisabled), _voidTime{voidTime}
 {
+	if(_voidTime > _MaxSrvcTime)	// Longer settings would void the MPB as soon as it's pressed, see TmLtchMPBttn::setSrvcTime()
+		_voidTime = _MaxSrvcTime;
 }
 
 TmVdblMPBttn::~TmVdblMPBttn()
 {
+	_dsrmTmr(_voidTmr);
 }
 
 bool TmVdblMPBttn::begin(const unsigned long int &pollDelayMs){
@@ -3406,24 +5257,54 @@ bool TmVdblMPBttn::begin(const unsigned long int &pollDelayMs){
    return result;
 }
 
-void TmVdblMPBttn::clrStatus(){
+void TmVdblMPBttn::_cfgPkg(uint8_t* &bufPtr){
+	VdblMPBttn::_cfgPkg(bufPtr);
+	_cfgWrt(bufPtr, _voidTime, 4);
+
+	return;
+}
+
+bool TmVdblMPBttn::_cfgUnpkg(const uint8_t* &bufPtr){
+	bool result{VdblMPBttn::_cfgUnpkg(bufPtr)};
+
+	if(!setVoidTime(_cfgRd(bufPtr, 4)))
+		result = false;
+
+	return result;
+}
+
+void TmVdblMPBttn::clrStatus(bool clrIsOn){
    _voidTmrStrt = 0;
-   VdblMPBttn::clrStatus();
+	_dsrmTmr(_voidTmr);
+   VdblMPBttn::clrStatus(clrIsOn);
 
    return;
 }
 
+uint8_t TmVdblMPBttn::_getCfgClsId(){
+
+	return 8;
+}
+
 const unsigned long int TmVdblMPBttn::getVoidTime() const{
 
 	return _voidTime;
 }
 
+const unsigned long int TmVdblMPBttn::getVoidTmRmnng() const{
+
+	return _getTmrRmnng(_voidTmr);
+}
+
 bool TmVdblMPBttn::setVoidTime(const unsigned long int &newVoidTime){
 	bool result{true};
 
 	if(newVoidTime != _voidTime){
-		if(newVoidTime >= _MinSrvcTime)
+		if((newVoidTime >= _MinSrvcTime) && (newVoidTime <= _MaxSrvcTime)){
 			_voidTime = newVoidTime;
+			if(_voidTmr.armd)	// The running voiding time count takes the new setting
+				_armTmr(_voidTmr, _voidTmrStrt + _voidTime);
+		}
 		else
 			result = false;
 	}
@@ -3433,6 +5314,7 @@ bool TmVdblMPBttn::setVoidTime(const unsigned long int &newVoidTime){
 
 void TmVdblMPBttn::stOffNotVPP_In(){
 	_voidTmrStrt = 0;
+	_dsrmTmr(_voidTmr);
 
 	return;
 }
@@ -3448,6 +5330,7 @@ void TmVdblMPBttn::stOffVddNVUP_Do(){
 
 void TmVdblMPBttn::stOffVPP_Do(){	// This provides a setting point for the voiding mechanism to be started
    _voidTmrStrt = millis();
+	_armTmr(_voidTmr, _voidTmrStrt + _voidTime);
 
 	return;
 }
@@ -3461,7 +5344,7 @@ bool TmVdblMPBttn::updVoidStatus(){
    bool result {false};
 
    if(_voidTmrStrt != 0){
-		if ((millis() - _voidTmrStrt) >= (_voidTime)){ // + _dbncTimeTempSett + _strtDelay
+		if (_voidTmr.expd){ // The void timer deadline was reached, no time calculation needed in each poll
 			result = true;
 		}
 	}
@@ -3517,21 +5400,1778 @@ bool SnglSrvcVdblMPBttn::updVoidStatus(){
 
 //=========================================================================> Class methods delimiter
 
+GstrMPBttn::GstrMPBttn()
+{
+}
+
+GstrMPBttn::GstrMPBttn(const uint8_t &mpbttnPin, const bool &pulledUp, const bool &typeNO, const unsigned long int &dbncTimeOrigSett, const unsigned long int &strtDelay)
+:DbncdDlydMPBttn(mpbttnPin, pulledUp, typeNO, dbncTimeOrigSett, strtDelay)
+{
+}
+
+GstrMPBttn::~GstrMPBttn()
+{
+}
+
+void GstrMPBttn::_armGstrDdln(const unsigned long int &curTm, const unsigned long int &dlyTm){
+	_gstrDdln = curTm + dlyTm;
+	_gstrDdlnArmd = true;
+
+	return;
+}
+
+void GstrMPBttn::_cfgPkg(uint8_t* &bufPtr){
+	DbncdDlydMPBttn::_cfgPkg(bufPtr);
+	_cfgWrt(bufPtr, _clcksMax, 1);
+	_cfgWrt(bufPtr, _clckWndw, 4);
+	_cfgWrt(bufPtr, _lngPrssTm, 4);
+	_cfgWrt(bufPtr, _hldRptDly, 4);
+	_cfgWrt(bufPtr, _hldRptPrd, 4);
+	_cfgWrt(bufPtr, _hldRptPrdMin, 4);
+	_cfgWrt(bufPtr, _hldRptAcclPrcnt, 1);
+
+	return;
+}
+
+bool GstrMPBttn::_cfgUnpkg(const uint8_t* &bufPtr){
+	uint8_t clcksMax{0};
+	unsigned long int clckWndw{0};
+	unsigned long int lngPrssTm{0};
+	unsigned long int hldRptDly{0};
+	unsigned long int hldRptPrd{0};
+	unsigned long int hldRptPrdMin{0};
+	uint8_t hldRptAcclPrcnt{0};
+	bool result{DbncdDlydMPBttn::_cfgUnpkg(bufPtr)};
+
+	clcksMax = _cfgRd(bufPtr, 1);
+	clckWndw = _cfgRd(bufPtr, 4);
+	lngPrssTm = _cfgRd(bufPtr, 4);
+	hldRptDly = _cfgRd(bufPtr, 4);
+	hldRptPrd = _cfgRd(bufPtr, 4);
+	hldRptPrdMin = _cfgRd(bufPtr, 4);
+	hldRptAcclPrcnt = _cfgRd(bufPtr, 1);
+	if(!setClcksMax(clcksMax))
+		result = false;
+	if(!setClckWndw(clckWndw))
+		result = false;
+	if(!setLngPrssTm(lngPrssTm))
+		result = false;
+	if(!setHldRpt(hldRptDly, hldRptPrd, hldRptPrdMin, hldRptAcclPrcnt))
+		result = false;
+
+	return result;
+}
+
+void GstrMPBttn::clrGstr(){
+	_MpbCrtclSctnBgn();
+	_gstr = GstrNone;
+	_gstrCnt = 0;
+	_MpbCrtclSctnEnd();
+
+	return;
+}
+
+void GstrMPBttn::clrStatus(bool clrIsOn){
+	_clcksCnt = 0;
+	_gstrDdlnArmd = false;
+	_hldRptCnt = 0;
+	_lngPrssd = false;
+	clrGstr();
+	DbncdMPBttn::clrStatus(clrIsOn);
+
+	return;
+}
+
+uint8_t GstrMPBttn::_getCfgClsId(){
+
+	return 9;
+}
+
+uint8_t GstrMPBttn::getClcksMax(){
+
+	return _clcksMax;
+}
+
+unsigned long int GstrMPBttn::getClckWndw(){
+
+	return _clckWndw;
+}
+
+uint8_t GstrMPBttn::getGstr(){
+
+	return _gstr;
+}
+
+uint8_t GstrMPBttn::getGstrCnt(){
+
+	return _gstrCnt;
+}
+
+unsigned long int GstrMPBttn::getLngPrssTm(){
+
+	return _lngPrssTm;
+}
+
+void GstrMPBttn::_gnrtGstr(const uint8_t &gstr, const uint8_t &gstrCnt){
+	//---------------->> Flags related actions
+	_gstr = gstr;
+	_gstrCnt = gstrCnt;
+	setOutputsChange(true);
+	//---------------->> Functions related actions
+	if(_fnVdPtrPrmWhnGstr != nullptr)
+		_fnVdPtrPrmWhnGstr(_fnVdPtrPrmWhnGstrArgPtr);
+
+	return;
+}
+
+void GstrMPBttn::mpbPollCallback(){
+	bool prvIsOn {_isOn};
+
+	DbncdMPBttn::mpbPollCallback();
+	if(_isEnabled){
+		_updGstr(prvIsOn);
+	}
+	else{	// While disabled no gestures are recognized, the gestures in progress are discarded
+		_clcksCnt = 0;
+		_gstrDdlnArmd = false;
+		_lngPrssd = false;
+	}
+
+	return;
+}
+
+uint32_t GstrMPBttn::_otptsSttsPkg(uint32_t prevVal){
+	prevVal = DbncdMPBttn::_otptsSttsPkg(prevVal);
+	prevVal &= ~(((uint32_t)0xFFFF) << OtptCurValBitPos);
+	prevVal |= ((((uint32_t)_gstr) << 8) | _gstrCnt) << OtptCurValBitPos;
+
+	return prevVal;
+}
+
+bool GstrMPBttn::setClcksMax(const uint8_t &newClcksMax){
+	bool result {false};
+
+	if(newClcksMax > 0){
+		if(_clcksMax != newClcksMax)
+			_clcksMax = newClcksMax;
+		result = true;
+	}
+
+	return result;
+}
+
+bool GstrMPBttn::setClckWndw(const unsigned long int &newClckWndw){
+	bool result {false};
+
+	if(newClckWndw > 0){
+		if(_clckWndw != newClckWndw){
+			_MpbCrtclSctnBgn();
+			_clckWndw = newClckWndw;
+			_MpbCrtclSctnEnd();
+		}
+		result = true;
+	}
+
+	return result;
+}
+
+void GstrMPBttn::setFVPPWhnGstr(fncVdPtrPrmPtrType newFVPPWhnGstr, void* argPtr){
+	_MpbCrtclSctnBgn();
+	if(_fnVdPtrPrmWhnGstr != newFVPPWhnGstr)
+		_fnVdPtrPrmWhnGstr = newFVPPWhnGstr;
+	if(_fnVdPtrPrmWhnGstrArgPtr != argPtr)
+		_fnVdPtrPrmWhnGstrArgPtr = argPtr;
+	_MpbCrtclSctnEnd();
+
+	return;
+}
+
+bool GstrMPBttn::setHldRpt(const unsigned long int &newHldRptDly, const unsigned long int &newHldRptPrd, const unsigned long int &newHldRptPrdMin, const uint8_t &newHldRptAcclPrcnt){
+	bool result {false};
+
+	if(((newHldRptDly == 0) || (newHldRptPrd > 0)) && (newHldRptAcclPrcnt < 100)){
+		_MpbCrtclSctnBgn();
+		_hldRptDly = newHldRptDly;
+		_hldRptPrd = newHldRptPrd;
+		_hldRptPrdMin = ((newHldRptPrdMin == 0) || (newHldRptPrdMin > newHldRptPrd))?newHldRptPrd:newHldRptPrdMin;
+		_hldRptAcclPrcnt = newHldRptAcclPrcnt;
+		_MpbCrtclSctnEnd();
+		result = true;
+	}
+
+	return result;
+}
+
+bool GstrMPBttn::setLngPrssTm(const unsigned long int &newLngPrssTm){
+	bool result {false};
+
+	if(newLngPrssTm >= _MinSrvcTime){
+		if(_lngPrssTm != newLngPrssTm){
+			_MpbCrtclSctnBgn();
+			_lngPrssTm = newLngPrssTm;
+			_MpbCrtclSctnEnd();
+		}
+		result = true;
+	}
+
+	return result;
+}
+
+void GstrMPBttn::_updGstr(const bool &prvIsOn){
+	unsigned long int curTm {0};
+
+	if((_isOn != prvIsOn) || _gstrDdlnArmd){	// Idle objects, with no isOn change and no deadline armed, need no processing
+		curTm = millis();
+		if(_isOn != prvIsOn){
+			if(_isOn){	// A press started, the long press deadline is armed
+				_lngPrssd = false;
+				_armGstrDdln(curTm, _lngPrssTm);
+			}
+			else if(_lngPrssd){	// A long press (and it's hold repeats) ended, no gesture pending
+				_lngPrssd = false;
+				_gstrDdlnArmd = false;
+			}
+			else{	// A click ended
+				++_clcksCnt;
+				if(_clcksCnt >= _clcksMax){
+					_gnrtGstr(GstrClck, _clcksCnt);
+					_clcksCnt = 0;
+					_gstrDdlnArmd = false;
+				}
+				else{
+					_armGstrDdln(curTm, _clckWndw);
+				}
+			}
+		}
+		else if((long)(curTm - _gstrDdln) >= 0){	// The armed deadline was reached
+			if(!_isOn){	// The click window expired with no new press
+				_gnrtGstr(GstrClck, _clcksCnt);
+				_clcksCnt = 0;
+				_gstrDdlnArmd = false;
+			}
+			else if(!_lngPrssd){	// The long press time was reached, any clicks sequence in progress is discarded
+				_lngPrssd = true;
+				_clcksCnt = 0;
+				_gnrtGstr(GstrLngPrss, 1);
+				if(_hldRptDly > 0){
+					_hldRptCnt = 0;
+					_hldRptCurPrd = _hldRptPrd;
+					_armGstrDdln(curTm, _hldRptDly);
+				}
+				else{
+					_gstrDdlnArmd = false;
+				}
+			}
+			else{	// The hold repeat time was reached, the next repeat period is accelerated
+				if(_hldRptCnt < 0xFF)
+					++_hldRptCnt;
+				_gnrtGstr(GstrHldRpt, _hldRptCnt);
+				_armGstrDdln(curTm, _hldRptCurPrd);
+				if(_hldRptAcclPrcnt > 0){
+					_hldRptCurPrd -= (_hldRptCurPrd * _hldRptAcclPrcnt) / 100;
+					if(_hldRptCurPrd < _hldRptPrdMin)
+						_hldRptCurPrd = _hldRptPrdMin;
+				}
+			}
+		}
+	}
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+//===========================>> BEGIN MpbInptPrvdr Static variables initialization
+MpbInptPrvdr* MpbInptPrvdr::_snpshtUpdLstPtr = nullptr;	// Pointer to the first element of the linked list of input providers whose snapshot must be updated every timer interrupt service
+//===========================>> END MpbInptPrvdr Static variables initialization
+
+//===========================>> BEGIN MpbInptPrvdr Static methods implementation
+void MpbInptPrvdr::_updSnpshts(){
+	MpbInptPrvdr* auxPtr {_snpshtUpdLstPtr};
+
+	while(auxPtr != nullptr){
+		auxPtr->updSnpsht();
+		auxPtr = auxPtr->_nxtSnpshtUpd;
+	}
+
+	return;
+}
+//===========================>> END MpbInptPrvdr Static methods implementation
+
+MpbInptPrvdr::MpbInptPrvdr()
+{
+}
+
+MpbInptPrvdr::~MpbInptPrvdr()
+{
+	setSnpshtUpd(false);
+}
+
+bool MpbInptPrvdr::getSnpshtUpd(){
+
+	return _snpshtUpd;
+}
+
+void MpbInptPrvdr::setSnpshtUpd(const bool &newSnpshtUpd){
+	MpbInptPrvdr** auxPtr {&_snpshtUpdLstPtr};
+
+	if(_snpshtUpd != newSnpshtUpd){
+		_MpbCrtclSctnBgn();
+		if(newSnpshtUpd){	// Insert at the head of the list
+			_nxtSnpshtUpd = _snpshtUpdLstPtr;
+			_snpshtUpdLstPtr = this;
+		}
+		else{	// Unlink from the list
+			while(*auxPtr != nullptr){
+				if(*auxPtr == this){
+					*auxPtr = _nxtSnpshtUpd;
+					break;
+				}
+				auxPtr = &((*auxPtr)->_nxtSnpshtUpd);
+			}
+			_nxtSnpshtUpd = nullptr;
+		}
+		_snpshtUpd = newSnpshtUpd;
+		_MpbCrtclSctnEnd();
+	}
+
+	return;
+}
+
+void MpbInptPrvdr::updSnpsht(){
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+MpbSttLstnr::~MpbSttLstnr()
+{
+}
+
+//=========================================================================> Class methods delimiter
+
+MpbBnk::MpbBnk()
+{
+}
+
+MpbBnk::MpbBnk(DbncdMPBttn** mbrsArr, const uint8_t &mbrsQty)
+{
+	if(mbrsArr != nullptr){
+		for(uint8_t i{0}; i < mbrsQty; ++i)
+			addMpb(*(mbrsArr + i));
+	}
+}
+
+MpbBnk::~MpbBnk()
+{
+	delete [] _mbrsLstPtr;
+}
+
+bool MpbBnk::addMpb(DbncdMPBttn* mpb){
+	bool result {false};
+
+	if(mpb != nullptr){
+		DbncdMPBttn::_pushMpb(_mbrsLstPtr, mpb);	// The same list management as the "MPBs to be updated list", no duplicates are added
+		result = true;
+	}
+
+	return result;
+}
+
+void MpbBnk::clrStatus(bool clrIsOn){
+	int auxPtr{0};
+
+	if(_mbrsLstPtr != nullptr){
+		while(*(_mbrsLstPtr + auxPtr) != nullptr){
+			(*(_mbrsLstPtr + auxPtr))->clrStatus(clrIsOn);
+			++auxPtr;
+		}
+	}
+
+	return;
+}
+
+void MpbBnk::disable(){
+	int auxPtr{0};
+
+	if(_mbrsLstPtr != nullptr){
+		while(*(_mbrsLstPtr + auxPtr) != nullptr){
+			(*(_mbrsLstPtr + auxPtr))->disable();
+			++auxPtr;
+		}
+	}
+
+	return;
+}
+
+void MpbBnk::enable(){
+	int auxPtr{0};
+
+	if(_mbrsLstPtr != nullptr){
+		while(*(_mbrsLstPtr + auxPtr) != nullptr){
+			(*(_mbrsLstPtr + auxPtr))->enable();
+			++auxPtr;
+		}
+	}
+
+	return;
+}
+
+uint8_t MpbBnk::getMbrsQty(){
+	uint8_t result {0};
+
+	if(_mbrsLstPtr != nullptr){
+		while(*(_mbrsLstPtr + result) != nullptr)
+			++result;
+	}
+
+	return result;
+}
+
+bool MpbBnk::pause(){
+	bool result {true};
+	bool prdChng {false};
+	int auxPtr{0};
+	DbncdMPBttn* mbrPtr {nullptr};
+
+	if(_mbrsLstPtr != nullptr){
+		while(*(_mbrsLstPtr + auxPtr) != nullptr){
+			mbrPtr = *(_mbrsLstPtr + auxPtr);
+			if(mbrPtr->_inUpdLst){
+				if(mbrPtr->_updTmrAttchd){
+					mbrPtr->_setUpdTmrAttchd(false);	// The timer period is recalculated once, after all the members are detached
+					prdChng = true;
+				}
+			}
+			else{
+				result = false;
+			}
+			++auxPtr;
+		}
+		if(prdChng)
+			DbncdMPBttn::_updTmrPrd();
+	}
+
+	return result;
+}
+
+bool MpbBnk::resume(){
+	bool result {true};
+	bool prdChng {false};
+	int auxPtr{0};
+	DbncdMPBttn* mbrPtr {nullptr};
+
+	if(_mbrsLstPtr != nullptr){
+		while(*(_mbrsLstPtr + auxPtr) != nullptr){
+			mbrPtr = *(_mbrsLstPtr + auxPtr);
+			if(mbrPtr->_inUpdLst && (mbrPtr->_pollPeriodMs > 0)){
+				if(!mbrPtr->_updTmrAttchd){
+					mbrPtr->resetFda();	// To restart in a safe situation the FDA is resetted to have all flags and timers cleaned up
+					mbrPtr->_setUpdTmrAttchd(true);	// The timer period is recalculated once, after all the members are attached
+					prdChng = true;
+				}
+			}
+			else{
+				result = false;
+			}
+			++auxPtr;
+		}
+		if(prdChng)
+			DbncdMPBttn::_updTmrPrd();
+	}
+
+	return result;
+}
+
+bool MpbBnk::rmvMpb(DbncdMPBttn* mpb){
+	bool result {false};
+	int auxPtr{0};
+
+	if((_mbrsLstPtr != nullptr) && (mpb != nullptr)){
+		while(*(_mbrsLstPtr + auxPtr) != nullptr){
+			if(*(_mbrsLstPtr + auxPtr) == mpb){
+				result = true;
+				break;
+			}
+			++auxPtr;
+		}
+		if(result)
+			DbncdMPBttn::_popMpb(_mbrsLstPtr, mpb);
+	}
+
+	return result;
+}
+
+//=========================================================================> Class methods delimiter
+
+MpbRdGrp::MpbRdGrp()
+{
+}
+
+MpbRdGrp::MpbRdGrp(LtchMPBttn** mbrsArr, const uint8_t &mbrsQty)
+{
+	if(mbrsArr != nullptr){
+		for(uint8_t i{0}; i < mbrsQty; ++i)
+			addMpb(*(mbrsArr + i));
+	}
+}
+
+MpbRdGrp::~MpbRdGrp()
+{
+	int auxPtr{0};
+
+	if(_mbrsLstPtr != nullptr){
+		while(*(_mbrsLstPtr + auxPtr) != nullptr){
+			(*(_mbrsLstPtr + auxPtr))->rmvSttLstnr(this);
+			++auxPtr;
+		}
+		delete [] _mbrsLstPtr;
+	}
+}
+
+bool MpbRdGrp::addMpb(LtchMPBttn* mpb){
+	bool result {false};
+
+	if((mpb != nullptr) && mpb->getUnltchSpprtd()){	// An object that never latches can't be unlatched by the group, so it's not added
+		if(mpb->addSttLstnr(this)){	// An object with no free state listener slot can't notify the group, so it's not added
+			DbncdMPBttn::_pushMpb(_mbrsLstPtr, mpb);	// The same list management as the "MPBs to be updated list", no duplicates are added
+			_MpbCrtclSctnBgn();
+			if(mpb->getIsOn()){
+				if(_actvMbr == nullptr)
+					_actvMbr = mpb;
+				else if(_actvMbr != mpb)
+					mpb->unlatch();
+			}
+			_MpbCrtclSctnEnd();
+			result = true;
+		}
+	}
+
+	return result;
+}
+
+bool MpbRdGrp::clrSlctn(){
+	bool result {false};
+
+	_MpbCrtclSctnBgn();
+	if(_actvMbr != nullptr)
+		result = _actvMbr->unlatch();	// The active member will be cleared by the mpbTrndOff() notification when it turns Off
+	_MpbCrtclSctnEnd();
+
+	return result;
+}
+
+LtchMPBttn* MpbRdGrp::getActvMbr(){
+	LtchMPBttn* result {nullptr};
+
+	_MpbCrtclSctnBgn();
+	result = _actvMbr;
+	_MpbCrtclSctnEnd();
+
+	return result;
+}
+
+uint8_t MpbRdGrp::getActvMbrIdx(){
+	uint8_t result {0xFF};
+	uint8_t auxPtr{0};
+	LtchMPBttn* actvMbr {getActvMbr()};
+
+	if((_mbrsLstPtr != nullptr) && (actvMbr != nullptr)){
+		while(*(_mbrsLstPtr + auxPtr) != nullptr){
+			if(*(_mbrsLstPtr + auxPtr) == actvMbr){
+				result = auxPtr;
+				break;
+			}
+			++auxPtr;
+		}
+	}
+
+	return result;
+}
+
+uint8_t MpbRdGrp::getMbrsQty(){
+	uint8_t result {0};
+
+	if(_mbrsLstPtr != nullptr){
+		while(*(_mbrsLstPtr + result) != nullptr)
+			++result;
+	}
+
+	return result;
+}
+
+void MpbRdGrp::mpbTrndOff(DbncdMPBttn* mpbPtr){
+	if(_actvMbr == mpbPtr)
+		_actvMbr = nullptr;
+
+	return;
+}
+
+void MpbRdGrp::mpbTrndOn(DbncdMPBttn* mpbPtr){
+	/*Only LtchMPBttn subclasses objects are accepted as members, so they are the only ones notifying the group*/
+	if(_actvMbr != mpbPtr){
+		if(_actvMbr != nullptr)
+			_actvMbr->unlatch();
+		_actvMbr = static_cast<LtchMPBttn*>(mpbPtr);
+	}
+
+	return;
+}
+
+bool MpbRdGrp::rmvMpb(LtchMPBttn* mpb){
+	bool result {false};
+	int auxPtr{0};
+
+	if((_mbrsLstPtr != nullptr) && (mpb != nullptr)){
+		while(*(_mbrsLstPtr + auxPtr) != nullptr){
+			if(*(_mbrsLstPtr + auxPtr) == mpb){
+				result = true;
+				break;
+			}
+			++auxPtr;
+		}
+		if(result){
+			mpb->rmvSttLstnr(this);
+			_MpbCrtclSctnBgn();
+			if(_actvMbr == mpb)
+				_actvMbr = nullptr;
+			_MpbCrtclSctnEnd();
+			DbncdMPBttn::_popMpb(_mbrsLstPtr, mpb);
+		}
+	}
+
+	return result;
+}
+
+//=========================================================================> Class methods delimiter
+
+MpbChrdDtctr::MpbChrdDtctr(DbncdMPBttn** mbrsArr, const uint8_t &mbrsQty, const uint8_t &ptrnsMax)
+: _ptrnsMax{ptrnsMax}
+{
+	if((mbrsArr != nullptr) && (mbrsQty > 0)){
+		_mbrsQty = (mbrsQty > 16)?16:mbrsQty;	// The members On state is kept in a 16 bits mask
+		_mbrsArr = new DbncdMPBttn* [_mbrsQty];
+		_mbrsOnTmArr = new unsigned long int [_mbrsQty];
+		for(uint8_t i{0}; i < _mbrsQty; ++i){
+			*(_mbrsArr + i) = *(mbrsArr + i);
+			*(_mbrsOnTmArr + i) = 0;
+			if(*(_mbrsArr + i) != nullptr){
+				if((*(_mbrsArr + i))->getIsOn())
+					_mbrsOnMsk |= (1U << i);
+				if(!(*(_mbrsArr + i))->addSttLstnr(this))	// The member has no free state listener slot, it's changes won't be notified
+					_mbrsLnkd = false;
+			}
+		}
+	}
+	if(_ptrnsMax > 0)
+		_ptrnsArr = new chrdPtrn_t [_ptrnsMax];
+}
+
+MpbChrdDtctr::~MpbChrdDtctr()
+{
+	for(uint8_t i{0}; i < _mbrsQty; ++i){
+		if(*(_mbrsArr + i) != nullptr)
+			(*(_mbrsArr + i))->rmvSttLstnr(this);
+	}
+	for(uint8_t i{0}; i < _ptrnsQty; ++i)
+		delete [] (_ptrnsArr + i)->sqncArr;
+	delete [] _ptrnsArr;
+	delete [] _mbrsOnTmArr;
+	delete [] _mbrsArr;
+}
+
+uint8_t MpbChrdDtctr::addChrd(const uint16_t &mbrsMsk, const unsigned long int &wndwMs){
+	uint8_t result {0xFF};
+
+	if((mbrsMsk != 0) && ((mbrsMsk >> _mbrsQty) == 0))
+		result = _addPtrn(mbrsMsk, nullptr, 0, wndwMs);
+
+	return result;
+}
+
+uint8_t MpbChrdDtctr::_addPtrn(const uint16_t &mbrsMsk, uint8_t* sqncArr, const uint8_t &sqncLen, const unsigned long int &wndwMs){
+	uint8_t result {0xFF};
+
+	if(_ptrnsQty < _ptrnsMax){
+		chrdPtrn_t &ptrn = *(_ptrnsArr + _ptrnsQty);
+
+		ptrn.mbrsMsk = mbrsMsk;
+		ptrn.sqncArr = sqncArr;
+		ptrn.sqncLen = sqncLen;
+		ptrn.sqncStp = 0;
+		ptrn.sqncLstTm = 0;
+		ptrn.wndwMs = wndwMs;
+		ptrn.fnWhnTrnOff = nullptr;
+		ptrn.fnWhnTrnOn = nullptr;
+		ptrn.isOn = false;
+		ptrn.outputsChange = false;
+		result = _ptrnsQty;
+		++_ptrnsQty;	// The pattern is made visible to the notifications once completely set
+	}
+
+	return result;
+}
+
+uint8_t MpbChrdDtctr::addSqnc(const uint8_t* mbrsIdxArr, const uint8_t &sqncLen, const unsigned long int &wndwMs){
+	uint8_t result {0xFF};
+	uint16_t mbrsMsk{0};
+	uint8_t* sqncArr{nullptr};
+
+	if((mbrsIdxArr != nullptr) && (sqncLen > 0) && (_ptrnsQty < _ptrnsMax)){
+		for(uint8_t i{0}; i < sqncLen; ++i){
+			if(*(mbrsIdxArr + i) >= _mbrsQty){
+				mbrsMsk = 0;
+				break;
+			}
+			mbrsMsk |= (1U << *(mbrsIdxArr + i));
+		}
+		if(mbrsMsk != 0){
+			sqncArr = new uint8_t [sqncLen];
+			for(uint8_t i{0}; i < sqncLen; ++i)
+				*(sqncArr + i) = *(mbrsIdxArr + i);
+			result = _addPtrn(mbrsMsk, sqncArr, sqncLen, wndwMs);
+		}
+	}
+
+	return result;
+}
+
+bool MpbChrdDtctr::getIsOn(const uint8_t &ptrnId){
+	bool result {false};
+
+	if(ptrnId < _ptrnsQty)
+		result = (_ptrnsArr + ptrnId)->isOn;
+
+	return result;
+}
+
+bool MpbChrdDtctr::getMbrsLnkd(){
+
+	return _mbrsLnkd;
+}
+
+uint8_t MpbChrdDtctr::_getMbrIdx(DbncdMPBttn* mpbPtr){
+	uint8_t result {0xFF};
+
+	for(uint8_t i{0}; i < _mbrsQty; ++i){
+		if(*(_mbrsArr + i) == mpbPtr){
+			result = i;
+			break;
+		}
+	}
+
+	return result;
+}
+
+bool MpbChrdDtctr::getOutputsChange(const uint8_t &ptrnId){
+	bool result {false};
+
+	if(ptrnId < _ptrnsQty)
+		result = (_ptrnsArr + ptrnId)->outputsChange;
+
+	return result;
+}
+
+uint8_t MpbChrdDtctr::getPtrnsQty(){
+
+	return _ptrnsQty;
+}
+
+void MpbChrdDtctr::mpbTrndOff(DbncdMPBttn* mpbPtr){
+	uint8_t mbrIdx {_getMbrIdx(mpbPtr)};
+
+	if(mbrIdx != 0xFF){
+		_mbrsOnMsk &= ~(1U << mbrIdx);
+		for(uint8_t i{0}; i < _ptrnsQty; ++i){
+			chrdPtrn_t &ptrn = *(_ptrnsArr + i);
+
+			if(ptrn.isOn){
+				if(ptrn.sqncArr == nullptr){	// Chord pattern: any member of the chord turning Off ends it
+					if(ptrn.mbrsMsk & (1U << mbrIdx))
+						_turnOffPtrn(ptrn);
+				}
+				else{	// Sequence pattern: the last member of the sequence turning Off ends it
+					if(*(ptrn.sqncArr + ptrn.sqncLen - 1) == mbrIdx)
+						_turnOffPtrn(ptrn);
+				}
+			}
+		}
+	}
+
+	return;
+}
+
+void MpbChrdDtctr::mpbTrndOn(DbncdMPBttn* mpbPtr){
+	uint8_t mbrIdx {_getMbrIdx(mpbPtr)};
+	unsigned long int curTm {millis()};
+	unsigned long int frstOnTm{0};
+
+	if(mbrIdx != 0xFF){
+		_mbrsOnMsk |= (1U << mbrIdx);
+		*(_mbrsOnTmArr + mbrIdx) = curTm;
+		for(uint8_t i{0}; i < _ptrnsQty; ++i){
+			chrdPtrn_t &ptrn = *(_ptrnsArr + i);
+
+			if(ptrn.sqncArr == nullptr){	// Chord pattern
+				if((!ptrn.isOn) && (ptrn.mbrsMsk & (1U << mbrIdx)) && ((_mbrsOnMsk & ptrn.mbrsMsk) == ptrn.mbrsMsk)){	// This member completes the chord, check the time window from the first member of the chord turning On
+					frstOnTm = curTm;
+					for(uint8_t j{0}; j < _mbrsQty; ++j){
+						if((ptrn.mbrsMsk & (1U << j)) && ((curTm - *(_mbrsOnTmArr + j)) > (curTm - frstOnTm)))
+							frstOnTm = *(_mbrsOnTmArr + j);
+					}
+					if((curTm - frstOnTm) <= ptrn.wndwMs)
+						_turnOnPtrn(ptrn);
+				}
+			}
+			else{	// Sequence pattern
+				if((*(ptrn.sqncArr + ptrn.sqncStp) == mbrIdx) && ((ptrn.sqncStp == 0) || ((curTm - ptrn.sqncLstTm) <= ptrn.wndwMs))){	// The expected next member of the sequence, in time
+					++ptrn.sqncStp;
+				}
+				else if(*ptrn.sqncArr == mbrIdx){	// Out of sequence or out of time, but it's the sequence's first member: restart the sequence
+					ptrn.sqncStp = 1;
+				}
+				else{
+					ptrn.sqncStp = 0;
+				}
+				ptrn.sqncLstTm = curTm;
+				if(ptrn.sqncStp == ptrn.sqncLen){
+					ptrn.sqncStp = 0;
+					_turnOnPtrn(ptrn);
+				}
+			}
+		}
+	}
+
+	return;
+}
+
+void MpbChrdDtctr::setFnWhnTrnOffPtr(const uint8_t &ptrnId, void (*newFnWhnTrnOff)()){
+	if(ptrnId < _ptrnsQty){
+		if((_ptrnsArr + ptrnId)->fnWhnTrnOff != newFnWhnTrnOff){
+			_MpbCrtclSctnBgn();
+			(_ptrnsArr + ptrnId)->fnWhnTrnOff = newFnWhnTrnOff;
+			_MpbCrtclSctnEnd();
+		}
+	}
+
+	return;
+}
+
+void MpbChrdDtctr::setFnWhnTrnOnPtr(const uint8_t &ptrnId, void (*newFnWhnTrnOn)()){
+	if(ptrnId < _ptrnsQty){
+		if((_ptrnsArr + ptrnId)->fnWhnTrnOn != newFnWhnTrnOn){
+			_MpbCrtclSctnBgn();
+			(_ptrnsArr + ptrnId)->fnWhnTrnOn = newFnWhnTrnOn;
+			_MpbCrtclSctnEnd();
+		}
+	}
+
+	return;
+}
+
+void MpbChrdDtctr::setOutputsChange(const uint8_t &ptrnId, bool newOutputsChange){
+	if(ptrnId < _ptrnsQty){
+		if((_ptrnsArr + ptrnId)->outputsChange != newOutputsChange)
+			(_ptrnsArr + ptrnId)->outputsChange = newOutputsChange;
+	}
+
+	return;
+}
+
+void MpbChrdDtctr::_turnOffPtrn(chrdPtrn_t &ptrn){
+
+	if(ptrn.isOn){
+		//---------------->> Functions related actions
+		if(ptrn.fnWhnTrnOff != nullptr)
+			ptrn.fnWhnTrnOff();
+		//---------------->> Flags related actions
+		ptrn.isOn = false;
+		ptrn.outputsChange = true;
+	}
+
+	return;
+}
+
+void MpbChrdDtctr::_turnOnPtrn(chrdPtrn_t &ptrn){
+
+	if(!ptrn.isOn){
+		//---------------->> Functions related actions
+		if(ptrn.fnWhnTrnOn != nullptr)
+			ptrn.fnWhnTrnOn();
+		//---------------->> Flags related actions
+		ptrn.isOn = true;
+		ptrn.outputsChange = true;
+	}
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+MpbPrstnc::MpbPrstnc()
+{
+}
+
+MpbPrstnc::MpbPrstnc(DbncdMPBttn** mbrsArr, const uint8_t &mbrsQty, const uint16_t &eeStrtAddr, const uint16_t &eeSz, const unsigned long int &stblTm)
+: _eeStrtAddr{eeStrtAddr}, _stblTm{stblTm}
+{
+	if((mbrsArr != nullptr) && (mbrsQty > 0)){
+		_mbrsQty = (mbrsQty > 84)?84:mbrsQty;	// The record size is kept in a byte: 2 + 3 * 84 = 254
+		_rcrdSz = 2 + (3 * _mbrsQty);
+		_rcrdsQty = ((eeSz / _rcrdSz) > 254)?254:(eeSz / _rcrdSz);	// Less records than sequence numbers are needed to find the last written
+		_mbrsArr = new DbncdMPBttn* [_mbrsQty];
+		for(uint8_t i{0}; i < _mbrsQty; ++i)
+			*(_mbrsArr + i) = *(mbrsArr + i);
+		_rcrdBffr = new uint8_t [_rcrdSz]();
+		_cnddtBffr = new uint8_t [_rcrdSz]();
+		_wrtIdx = _rcrdSz;	// No record being written
+	}
+}
+
+MpbPrstnc::~MpbPrstnc()
+{
+	delete [] _cnddtBffr;
+	delete [] _rcrdBffr;
+	delete [] _mbrsArr;
+}
+
+bool MpbPrstnc::begin(){
+	bool result{false};
+	uint8_t lstIdx{0};
+	uint8_t rcrdSeq{0};
+	uint32_t sttsPkg{0};
+	DbncdMPBttn* mbrPtr{nullptr};
+	bool mbrAttchd{false};
+
+	if(_rcrdsQty > 0){
+#if defined(_MpbEepromCmmtNdd)
+		EEPROM.begin(_eeStrtAddr + (_rcrdsQty * _rcrdSz));
+#endif
+		/*Find the last record written: a record passing the checksum verification that is not followed by a valid record holding it's successor sequence number.
+		Only valid records are considered, so erased, partially written or foreign data slots can't move the ring position*/
+		for(uint8_t i{0}; (i < _rcrdsQty) && !result; ++i){
+			if(_rdRcrd(i)){
+				rcrdSeq = *_rcrdBffr;
+				if(!(_rdRcrd((i + 1) % _rcrdsQty) && (*_rcrdBffr == ((rcrdSeq + 1) % 0xFF)))){
+					lstIdx = i;
+					result = true;
+				}
+			}
+		}
+		if(result){
+			_rdRcrd(lstIdx);	// The buffer might hold the following slot contents
+			_nxtRcrdIdx = (lstIdx + 1) % _rcrdsQty;
+			_nxtRcrdSeq = (*_rcrdBffr + 1) % 0xFF;
+			for(uint8_t i{0}; i < _mbrsQty; ++i){
+				mbrPtr = *(_mbrsArr + i);
+				if(mbrPtr != nullptr){
+					sttsPkg = ((uint32_t)*(_rcrdBffr + 1 + (3 * i))) | (((uint32_t)*(_rcrdBffr + 2 + (3 * i))) << OtptCurValBitPos) | (((uint32_t)*(_rcrdBffr + 3 + (3 * i))) << (OtptCurValBitPos + 8));
+					mbrAttchd = mbrPtr->_updTmrAttchd;
+					if(mbrAttchd)	// Keep the timer interrupt service from updating the member while it's state is restored
+						mbrPtr->_setUpdTmrAttchd(false);
+					mbrPtr->_rstrSttsPkg(sttsPkg);
+					if(mbrAttchd)
+						mbrPtr->_setUpdTmrAttchd(true);
+				}
+			}
+			for(uint8_t i{1}; i < _rcrdSz - 1; ++i)
+				*(_cnddtBffr + i) = *(_rcrdBffr + i);
+		}
+		else{
+			_nxtRcrdIdx = 0;	// No valid record, the ring is started from it's beginning
+			_nxtRcrdSeq = 0;
+			_takeSnpsht(_rcrdBffr);	// and the current members state is taken as the saved one
+			_takeSnpsht(_cnddtBffr);
+		}
+	}
+
+	return result;
+}
+
+uint8_t MpbPrstnc::_calcRcrdCrc(const uint8_t* rcrdPtr){
+	// CRC-8 (polynomial 0x07) of the sequence number and the members state, the seed depends on the record size so a records layout change invalidates the records saved
+	uint8_t result{_rcrdSz};
+
+	for(uint8_t i{0}; i < (_rcrdSz - 1); ++i){
+		result ^= *(rcrdPtr + i);
+		for(uint8_t j{0}; j < 8; ++j)
+			result = (result & 0x80)?((result << 1) ^ 0x07):(result << 1);
+	}
+
+	return result;
+}
+
+uint8_t MpbPrstnc::_eeRd(const uint16_t &addr){
+	uint8_t result{0xFF};
+
+#if defined(__AVR__)
+	result = eeprom_read_byte((const uint8_t*)(uintptr_t)addr);
+#elif defined(_MpbEepromLibAvlbl)
+	result = EEPROM.read(addr);
+#else
+	(void)addr;	// No EEPROM available to the build, reads as erased
+#endif
+
+	return result;
+}
+
+bool MpbPrstnc::_eeRdy(){
+	bool result{true};
+
+#if defined(__AVR__)
+	result = eeprom_is_ready();
+#endif
+
+	return result;
+}
+
+void MpbPrstnc::_eeWrt(const uint16_t &addr, const uint8_t &val){
+#if defined(__AVR__)
+	eeprom_update_byte((uint8_t*)(uintptr_t)addr, val);	// Starts the write cycle and returns, the EEPROM was verified to be ready
+#elif defined(_MpbEepromLibAvlbl)
+	EEPROM.write(addr, val);
+#else
+	(void)addr;	// No EEPROM available to the build, nothing is written
+	(void)val;
+#endif
+
+	return;
+}
+
+unsigned long int MpbPrstnc::getStblTm(){
+
+	return _stblTm;
+}
+
+bool MpbPrstnc::getWrtPndng(){
+
+	return (_cnddtPndng || (_wrtIdx < _rcrdSz));
+}
+
+bool MpbPrstnc::_rdRcrd(const uint8_t &rcrdIdx){
+	bool result{false};
+
+	for(uint8_t i{0}; i < _rcrdSz; ++i)
+		*(_rcrdBffr + i) = _eeRd(_eeStrtAddr + (rcrdIdx * _rcrdSz) + i);
+	if((*_rcrdBffr != 0xFF) && (_calcRcrdCrc(_rcrdBffr) == *(_rcrdBffr + _rcrdSz - 1)))
+		result = true;
+
+	return result;
+}
+
+void MpbPrstnc::setStblTm(const unsigned long int &newStblTm){
+	if(_stblTm != newStblTm)
+		_stblTm = newStblTm;
+
+	return;
+}
+
+bool MpbPrstnc::_takeSnpsht(uint8_t* bffrPtr){
+	// Fills the members state part of the buffer: the isOn and isVoided flags byte, and the otptCurVal register. Returns true if the buffer content changed
+	bool result{false};
+	uint32_t sttsPkg{0};
+	uint8_t sttsBytes[3]{};
+
+	for(uint8_t i{0}; i < _mbrsQty; ++i){
+		if(*(_mbrsArr + i) != nullptr)
+			sttsPkg = (*(_mbrsArr + i))->getOtptsSttsPkgd();
+		else
+			sttsPkg = 0;
+		sttsBytes[0] = (uint8_t)(sttsPkg & ((1UL << IsOnBitPos) | (1UL << IsVoidedBitPos)));
+		sttsBytes[1] = (uint8_t)(sttsPkg >> OtptCurValBitPos);
+		sttsBytes[2] = (uint8_t)(sttsPkg >> (OtptCurValBitPos + 8));
+		for(uint8_t j{0}; j < 3; ++j){
+			if(*(bffrPtr + 1 + (3 * i) + j) != sttsBytes[j]){
+				*(bffrPtr + 1 + (3 * i) + j) = sttsBytes[j];
+				result = true;
+			}
+		}
+	}
+
+	return result;
+}
+
+void MpbPrstnc::updPrstnc(){
+	bool sttsChng{false};
+
+	if(_rcrdsQty > 0){
+		if(_wrtIdx < _rcrdSz){	// A record is being written, write it's next byte if the EEPROM is ready
+			if(_eeRdy()){
+				_eeWrt(_eeStrtAddr + (_nxtRcrdIdx * _rcrdSz) + _wrtIdx, *(_rcrdBffr + _wrtIdx));
+				++_wrtIdx;
+				if(_wrtIdx == _rcrdSz){
+#if defined(_MpbEepromCmmtNdd)
+					EEPROM.commit();	// The complete record is saved from the RAM buffer to the flash memory
+#endif
+					_nxtRcrdIdx = (_nxtRcrdIdx + 1) % _rcrdsQty;
+					_nxtRcrdSeq = (_nxtRcrdSeq + 1) % 0xFF;
+				}
+			}
+		}
+		else{
+			sttsChng = _takeSnpsht(_cnddtBffr);
+			if(sttsChng){	// The members state changed, (re)start the stability time count
+				_cnddtPndng = true;
+				_cnddtTm = millis();
+			}
+			else if(_cnddtPndng && ((millis() - _cnddtTm) >= _stblTm)){
+				_cnddtPndng = false;
+				for(uint8_t i{1}; i < (_rcrdSz - 1); ++i){
+					if(*(_cnddtBffr + i) != *(_rcrdBffr + i)){
+						sttsChng = true;
+						*(_rcrdBffr + i) = *(_cnddtBffr + i);
+					}
+				}
+				if(sttsChng){	// The stable state differs from the saved one, start writing a new record
+					*_rcrdBffr = _nxtRcrdSeq;
+					*(_rcrdBffr + _rcrdSz - 1) = _calcRcrdCrc(_rcrdBffr);
+					_wrtIdx = 0;
+				}
+			}
+		}
+	}
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+ShftRgstrInptBnk::ShftRgstrInptBnk(const uint8_t &ldPin, const uint8_t &clkPin, const uint8_t &dataPin, const uint8_t &chipsQty)
+: _chipsQty{chipsQty}, _clkPin{clkPin}, _dataPin{dataPin}, _ldPin{ldPin}
+{
+	if(_chipsQty > 0){
+		_inptsSnpsht = new uint8_t [_chipsQty];
+		for(uint8_t i{0}; i < _chipsQty; ++i)
+			*(_inptsSnpsht + i) = 0xFF;	// All inputs at released level for pulled up inputs
+	}
+}
+
+ShftRgstrInptBnk::ShftRgstrInptBnk(const uint8_t &ldPin, const uint8_t &chipsQty)
+#if defined(PIN_SPI_SCK) && defined(PIN_SPI_MISO)
+:ShftRgstrInptBnk(ldPin, PIN_SPI_SCK, PIN_SPI_MISO, chipsQty)
+#else
+:ShftRgstrInptBnk(ldPin, _InvalidPinNum, _InvalidPinNum, chipsQty)
+#endif
+{
+#ifdef _MpbHwSpiAvlbl
+	_useHwSpi = true;
+#endif
+}
+
+ShftRgstrInptBnk::~ShftRgstrInptBnk()
+{
+	end();
+	delete [] _inptsSnpsht;
+}
+
+bool ShftRgstrInptBnk::begin(){
+	bool result {false};
+
+	if((_inptsSnpsht != nullptr) && (_ldPin != _InvalidPinNum) && (_useHwSpi || ((_clkPin != _InvalidPinNum) && (_dataPin != _InvalidPinNum)))){
+		digitalWrite(_ldPin, HIGH);
+		pinMode(_ldPin, OUTPUT);
+#ifdef _MpbHwSpiAvlbl
+		if(_useHwSpi){
+			SPI.begin();
+			SPI.usingInterrupt(255);	// The bus is used from the timer interrupt service, the SPI transactions of the rest of the code must be kept from being interrupted by it
+		}
+#endif
+		if(!_useHwSpi){
+			digitalWrite(_clkPin, LOW);
+			pinMode(_clkPin, OUTPUT);
+			pinMode(_dataPin, INPUT);
+		}
+#if defined(__AVR__)	// Direct port access: the pins masks and registers are resolved once, not at every reading
+		_ldPortReg = portOutputRegister(digitalPinToPort(_ldPin));
+		_ldPinMsk = digitalPinToBitMask(_ldPin);
+		if(!_useHwSpi){
+			_clkPortReg = portOutputRegister(digitalPinToPort(_clkPin));
+			_clkPinMsk = digitalPinToBitMask(_clkPin);
+			_dataPortReg = portInputRegister(digitalPinToPort(_dataPin));
+			_dataPinMsk = digitalPinToBitMask(_dataPin);
+		}
+#endif
+		_MpbCrtclSctnBgn();
+		updSnpsht();
+		_MpbCrtclSctnEnd();
+		setSnpshtUpd(true);
+		result = true;
+	}
+
+	return result;
+}
+
+void ShftRgstrInptBnk::end(){
+	setSnpshtUpd(false);
+
+	return;
+}
+
+uint16_t ShftRgstrInptBnk::getInptsQty(){
+
+	return ((uint16_t)_chipsQty) << 3;
+}
+
+bool ShftRgstrInptBnk::getInptLvl(const uint8_t &inptId){
+	bool result {HIGH};
+
+	if((inptId >> 3) < _chipsQty)
+		result = (*(_inptsSnpsht + (inptId >> 3)) >> (inptId & 0x07)) & 0x01;
+
+	return result;
+}
+
+uint8_t ShftRgstrInptBnk::_rdByte(){
+	uint8_t result {0};
+
+	for(uint8_t bitMsk {0x80}; bitMsk != 0; bitMsk >>= 1){	// Most significant bit (H input) is the first one available
+#if defined(__AVR__)
+		if(*_dataPortReg & _dataPinMsk)
+			result |= bitMsk;
+		*_clkPortReg |= _clkPinMsk;
+		*_clkPortReg &= ~_clkPinMsk;
+#else
+		if(digitalRead(_dataPin) == HIGH)
+			result |= bitMsk;
+		digitalWrite(_clkPin, HIGH);
+		digitalWrite(_clkPin, LOW);
+#endif
+	}
+
+	return result;
+}
+
+void ShftRgstrInptBnk::updSnpsht(){
+	// Parallel load pulse: the inputs levels are latched into the shift registers
+#if defined(__AVR__)
+	*_ldPortReg &= ~_ldPinMsk;
+	*_ldPortReg |= _ldPinMsk;
+#else
+	digitalWrite(_ldPin, LOW);
+	digitalWrite(_ldPin, HIGH);
+#endif
+	if(_useHwSpi){	// Only set when the SPI library is available
+#ifdef _MpbHwSpiAvlbl
+		SPI.beginTransaction(SPISettings(4000000, MSBFIRST, SPI_MODE0));
+		for(uint8_t i{0}; i < _chipsQty; ++i)
+			*(_inptsSnpsht + i) = SPI.transfer(0x00);
+		SPI.endTransaction();
+#endif
+	}
+	else{
+		for(uint8_t i{0}; i < _chipsQty; ++i)
+			*(_inptsSnpsht + i) = _rdByte();
+	}
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+//===========================>> BEGIN ShftRgstrOtptBnk Static variables initialization
+ShftRgstrOtptBnk* ShftRgstrOtptBnk::_otptsUpdLstPtr = nullptr;	// Pointer to the first element of the linked list of output banks to be written every timer interrupt service
+//===========================>> END ShftRgstrOtptBnk Static variables initialization
+
+//===========================>> BEGIN ShftRgstrOtptBnk Static methods implementation
+void ShftRgstrOtptBnk::_updOtptsBnks(){
+	ShftRgstrOtptBnk* auxPtr {_otptsUpdLstPtr};
+
+	while(auxPtr != nullptr){
+		auxPtr->updOtpts();
+		auxPtr = auxPtr->_nxtOtptsUpd;
+	}
+
+	return;
+}
+//===========================>> END ShftRgstrOtptBnk Static methods implementation
+
+ShftRgstrOtptBnk::ShftRgstrOtptBnk(const uint8_t &ltchPin, const uint8_t &clkPin, const uint8_t &dataPin, const uint8_t &chipsQty)
+: _chipsQty{chipsQty}, _clkPin{clkPin}, _dataPin{dataPin}, _ltchPin{ltchPin}
+{
+	if(_chipsQty > 0){
+		_otptsImg = new uint8_t [_chipsQty];
+		for(uint8_t i{0}; i < _chipsQty; ++i)
+			*(_otptsImg + i) = 0x00;
+		_otptsChng = true;
+	}
+}
+
+ShftRgstrOtptBnk::ShftRgstrOtptBnk(const uint8_t &ltchPin, const uint8_t &chipsQty)
+#if defined(PIN_SPI_SCK) && defined(PIN_SPI_MOSI)
+:ShftRgstrOtptBnk(ltchPin, PIN_SPI_SCK, PIN_SPI_MOSI, chipsQty)
+#else
+:ShftRgstrOtptBnk(ltchPin, _InvalidPinNum, _InvalidPinNum, chipsQty)
+#endif
+{
+#ifdef _MpbHwSpiAvlbl
+	_useHwSpi = true;
+#endif
+}
+
+ShftRgstrOtptBnk::~ShftRgstrOtptBnk()
+{
+	end();
+	delete [] _otptsImg;
+}
+
+bool ShftRgstrOtptBnk::begin(){
+	bool result {false};
+
+	if((_otptsImg != nullptr) && (_ltchPin != _InvalidPinNum) && (_useHwSpi || ((_clkPin != _InvalidPinNum) && (_dataPin != _InvalidPinNum)))){
+		digitalWrite(_ltchPin, LOW);
+		pinMode(_ltchPin, OUTPUT);
+#ifdef _MpbHwSpiAvlbl
+		if(_useHwSpi){
+			SPI.begin();
+			SPI.usingInterrupt(255);	// The bus is used from the timer interrupt service, the SPI transactions of the rest of the code must be kept from being interrupted by it
+		}
+#endif
+		if(!_useHwSpi){
+			digitalWrite(_clkPin, LOW);
+			pinMode(_clkPin, OUTPUT);
+			pinMode(_dataPin, OUTPUT);
+		}
+#if defined(__AVR__)	// Direct port access: the pins masks and registers are resolved once, not at every writing
+		_ltchPortReg = portOutputRegister(digitalPinToPort(_ltchPin));
+		_ltchPinMsk = digitalPinToBitMask(_ltchPin);
+		if(!_useHwSpi){
+			_clkPortReg = portOutputRegister(digitalPinToPort(_clkPin));
+			_clkPinMsk = digitalPinToBitMask(_clkPin);
+			_dataPortReg = portOutputRegister(digitalPinToPort(_dataPin));
+			_dataPinMsk = digitalPinToBitMask(_dataPin);
+		}
+#endif
+		_MpbCrtclSctnBgn();
+		_otptsChng = true;	// The chain content is unknown, the whole image is written
+		updOtpts();
+		if(!_otptsUpd){	// Insert at the head of the list
+			_nxtOtptsUpd = _otptsUpdLstPtr;
+			_otptsUpdLstPtr = this;
+			_otptsUpd = true;
+		}
+		_MpbCrtclSctnEnd();
+		result = true;
+	}
+
+	return result;
+}
+
+void ShftRgstrOtptBnk::end(){
+	ShftRgstrOtptBnk** auxPtr {&_otptsUpdLstPtr};
+
+	if(_otptsUpd){
+		_MpbCrtclSctnBgn();
+		while(*auxPtr != nullptr){	// Unlink from the list
+			if(*auxPtr == this){
+				*auxPtr = _nxtOtptsUpd;
+				break;
+			}
+			auxPtr = &((*auxPtr)->_nxtOtptsUpd);
+		}
+		_nxtOtptsUpd = nullptr;
+		_otptsUpd = false;
+		_MpbCrtclSctnEnd();
+	}
+
+	return;
+}
+
+bool ShftRgstrOtptBnk::getOtptLvl(const uint8_t &otptId){
+	bool result {LOW};
+
+	if((otptId >> 3) < _chipsQty)
+		result = (*(_otptsImg + (otptId >> 3)) >> (otptId & 0x07)) & 0x01;
+
+	return result;
+}
+
+uint16_t ShftRgstrOtptBnk::getOtptsQty(){
+
+	return ((uint16_t)_chipsQty) << 3;
+}
+
+bool ShftRgstrOtptBnk::setOtptLvl(const uint8_t &otptId, const bool &newLvl){
+	bool result {false};
+
+	if((otptId >> 3) < _chipsQty){
+		_MpbCrtclSctnBgn();
+		_setOtptImgLvl(otptId, newLvl);
+		_MpbCrtclSctnEnd();
+		result = true;
+	}
+
+	return result;
+}
+
+void ShftRgstrOtptBnk::_setOtptImgLvl(const uint8_t &otptId, const bool &newLvl){
+	// No range check and no critical section, the caller must provide both
+	uint8_t otptMsk {(uint8_t)(1U << (otptId & 0x07))};
+
+	if(((*(_otptsImg + (otptId >> 3)) & otptMsk) != 0) != newLvl){
+		*(_otptsImg + (otptId >> 3)) ^= otptMsk;
+		_otptsChng = true;
+	}
+
+	return;
+}
+
+void ShftRgstrOtptBnk::updOtpts(){
+	// The last shift register of the chain is written first, so the first one in the chain keeps the outputs 0 to 7
+	if(_otptsChng){
+		_otptsChng = false;
+		if(_useHwSpi){	// Only set when the SPI library is available
+#ifdef _MpbHwSpiAvlbl
+			SPI.beginTransaction(SPISettings(4000000, MSBFIRST, SPI_MODE0));
+			for(uint8_t i{_chipsQty}; i > 0; --i)
+				SPI.transfer(*(_otptsImg + (i - 1)));
+			SPI.endTransaction();
+#endif
+		}
+		else{
+			for(uint8_t i{_chipsQty}; i > 0; --i)
+				_wrtByte(*(_otptsImg + (i - 1)));
+		}
+		// Storage register clock pulse: the shifted levels are transferred to the parallel outputs
+#if defined(__AVR__)
+		*_ltchPortReg |= _ltchPinMsk;
+		*_ltchPortReg &= ~_ltchPinMsk;
+#else
+		digitalWrite(_ltchPin, HIGH);
+		digitalWrite(_ltchPin, LOW);
+#endif
+	}
+
+	return;
+}
+
+void ShftRgstrOtptBnk::_wrtByte(const uint8_t &otptByte){
+	for(uint8_t bitMsk {0x80}; bitMsk != 0; bitMsk >>= 1){	// Most significant bit (QH output) is the first one shifted
+#if defined(__AVR__)
+		if(otptByte & bitMsk)
+			*_dataPortReg |= _dataPinMsk;
+		else
+			*_dataPortReg &= ~_dataPinMsk;
+		*_clkPortReg |= _clkPinMsk;
+		*_clkPortReg &= ~_clkPinMsk;
+#else
+		digitalWrite(_dataPin, (otptByte & bitMsk) ? HIGH : LOW);
+		digitalWrite(_clkPin, HIGH);
+		digitalWrite(_clkPin, LOW);
+#endif
+	}
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+KpdMtrxInptBnk::KpdMtrxInptBnk(const uint8_t* rowPins, const uint8_t &rowsQty, const uint8_t* colPins, const uint8_t &colsQty)
+{
+	if((rowPins != nullptr) && (colPins != nullptr) && (rowsQty > 0) && (rowsQty <= 8) && (colsQty > 0) && (colsQty <= 8)){
+		_rowsQty = rowsQty;
+		_colsQty = colsQty;
+		_rowPins = new uint8_t [_rowsQty];
+		_colPins = new uint8_t [_colsQty];
+		_kysLvl = new uint8_t [_rowsQty];
+		_kysPrssd = new uint8_t [_rowsQty];
+		_scnRows = new uint8_t [_rowsQty];
+		for(uint8_t i{0}; i < _rowsQty; ++i){
+			*(_rowPins + i) = *(rowPins + i);
+			*(_kysLvl + i) = 0;
+			*(_kysPrssd + i) = 0;
+			*(_scnRows + i) = 0;
+		}
+		for(uint8_t i{0}; i < _colsQty; ++i)
+			*(_colPins + i) = *(colPins + i);
+	}
+}
+
+KpdMtrxInptBnk::~KpdMtrxInptBnk()
+{
+	end();
+	delete [] _scnRows;
+	delete [] _kysPrssd;
+	delete [] _kysLvl;
+	delete [] _colPins;
+	delete [] _rowPins;
+}
+
+bool KpdMtrxInptBnk::begin(){
+	bool result {false};
+
+	if(_rowsQty > 0){
+		for(uint8_t i{0}; i < _colsQty; ++i)
+			pinMode(*(_colPins + i), INPUT_PULLUP);
+		for(uint8_t i{0}; i < _rowsQty; ++i)
+			pinMode(*(_rowPins + i), INPUT);	// Not driven rows are kept in high impedance, so pressing several keys never shorts two outputs
+		_curRow = 0;
+		digitalWrite(*(_rowPins + _curRow), LOW);
+		pinMode(*(_rowPins + _curRow), OUTPUT);
+		setSnpshtUpd(true);
+		result = true;
+	}
+
+	return result;
+}
+
+bool KpdMtrxInptBnk::_chkGhstng(uint8_t &ghstRows, uint8_t &ghstCols){
+	/*A ghost key might appear only when two rows share two or more pressed columns, being the
+	three keys pressed and the fourth "looking pressed" in the corners of the rectangle. Every
+	ghost key lies in one of those rows and in one of those shared columns, so only the keys in
+	their intersections are ambiguous*/
+	uint8_t shrdCols {0};
+
+	ghstRows = 0;
+	ghstCols = 0;
+	for(uint8_t i{0}; i < (_rowsQty - 1); ++i){
+		if(*(_scnRows + i) != 0){
+			for(uint8_t j{(uint8_t)(i + 1)}; j < _rowsQty; ++j){
+				shrdCols = *(_scnRows + i) & *(_scnRows + j);
+				if(shrdCols & (shrdCols - 1)){	// More than one bit set
+					ghstRows |= (1 << i) | (1 << j);
+					ghstCols |= shrdCols;
+				}
+			}
+		}
+	}
+
+	return (ghstRows != 0);
+}
+
+void KpdMtrxInptBnk::end(){
+	setSnpshtUpd(false);
+	if(_rowsQty > 0)
+		pinMode(*(_rowPins + _curRow), INPUT);
+
+	return;
+}
+
+bool KpdMtrxInptBnk::getGhstDtctd(){
+
+	return _ghstDtctd;
+}
+
+bool KpdMtrxInptBnk::getInptLvl(const uint8_t &inptId){
+	bool result {HIGH};
+	uint8_t kyRow {0};
+
+	if(inptId < (_rowsQty * _colsQty)){
+		kyRow = inptId / _colsQty;
+		if(*(_kysLvl + kyRow) & (1 << (inptId - (kyRow * _colsQty))))
+			result = LOW;
+	}
+
+	return result;
+}
+
+bool KpdMtrxInptBnk::getKyPrssd(const uint8_t &kyId){
+	bool result {false};
+	uint8_t kyRow {0};
+
+	if(kyId < (_rowsQty * _colsQty)){
+		kyRow = kyId / _colsQty;
+		if(*(_kysPrssd + kyRow) & (1 << (kyId - (kyRow * _colsQty))))
+			result = true;
+	}
+
+	return result;
+}
+
+uint8_t KpdMtrxInptBnk::getKysQty(){
+
+	return _rowsQty * _colsQty;
+}
+
+void KpdMtrxInptBnk::updSnpsht(){
+	uint8_t ghstCols {0};
+	uint8_t ghstRows {0};
+	uint8_t rowLvl {0};
+
+	for(uint8_t i{0}; i < _colsQty; ++i){
+		if(digitalRead(*(_colPins + i)) == LOW)
+			rowLvl |= (1 << i);
+	}
+	*(_scnRows + _curRow) = rowLvl;
+	pinMode(*(_rowPins + _curRow), INPUT);	// Release the read row and drive the next one, to be read in the next timer interrupt
+	if(++_curRow == _rowsQty)
+		_curRow = 0;
+	digitalWrite(*(_rowPins + _curRow), LOW);
+	pinMode(*(_rowPins + _curRow), OUTPUT);
+
+	if(_curRow == 0){	// A complete scan was done
+		_ghstDtctd = _chkGhstng(ghstRows, ghstCols);
+		for(uint8_t i{0}; i < _rowsQty; ++i){
+			if(ghstRows & (1 << i))	// The ambiguous keys keep their last published level, the rest of the row is published
+				rowLvl = (*(_scnRows + i) & ~ghstCols) | (*(_kysLvl + i) & ghstCols);
+			else
+				rowLvl = *(_scnRows + i);
+			// The debounced level changes only for the keys whose level was kept for two complete scans
+			*(_kysPrssd + i) = (*(_kysPrssd + i) & (rowLvl | *(_kysLvl + i))) | (rowLvl & *(_kysLvl + i));
+			*(_kysLvl + i) = rowLvl;
+		}
+	}
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
+//===========================>> BEGIN AnlgLddrInptBnk Static variables initialization
+AnlgLddrInptBnk* AnlgLddrInptBnk::_adcOwnrPtr = nullptr;	// Pointer to the bank holding the analog to digital converter, nullptr if the converter is free to be taken by the next bank updated
+uint8_t AnlgLddrInptBnk::_actvBnksQty = 0;	// Quantity of banks set to be updated by the begin() method, sharing the analog to digital converter
+//===========================>> END AnlgLddrInptBnk Static variables initialization
+
+AnlgLddrInptBnk::AnlgLddrInptBnk(const uint8_t &anlgPin, const uint16_t* wndwsArr, const uint8_t &bttnsQty)
+: _anlgPin{anlgPin}
+{
+	if((wndwsArr != nullptr) && (bttnsQty > 0) && (bttnsQty < 0xFF)){
+		_bttnsQty = bttnsQty;
+		_wndws = new uint16_t [_bttnsQty * 2];
+		for(uint8_t i{0}; i < _bttnsQty; ++i){
+			*(_wndws + (2 * i)) = *(wndwsArr + (2 * i));
+			*(_wndws + (2 * i) + 1) = *(wndwsArr + (2 * i) + 1);
+		}
+	}
+}
+
+AnlgLddrInptBnk::~AnlgLddrInptBnk()
+{
+	end();
+	delete [] _wndws;
+}
+
+bool AnlgLddrInptBnk::begin(){
+	bool result {false};
+
+	if((_wndws != nullptr) && (_anlgPin != _InvalidPinNum)){
+		end();	// A bank already active releases the converter before it's channel is read again
+		_adcVal = analogRead(_anlgPin);	// Sets the converter channel and reference for the pin
+		_clssfyVal();
+#if defined(__AVR__) && defined(ADCSRA)
+		_admuxVal = ADMUX;
+	#if defined(MUX5)
+		_adcsrbVal = ADCSRB;
+	#endif
+#endif
+		_MpbCrtclSctnBgn();
+		_bnkActv = true;
+		++_actvBnksQty;
+		_MpbCrtclSctnEnd();
+		setSnpshtUpd(true);
+		result = true;
+	}
+
+	return result;
+}
+
+void AnlgLddrInptBnk::_clssfyVal(){
+	uint8_t bttnId {0xFF};
+
+	for(uint8_t i{0}; i < _bttnsQty; ++i){
+		if((_adcVal >= *(_wndws + (2 * i))) && (_adcVal <= *(_wndws + (2 * i) + 1))){
+			bttnId = i;
+			break;
+		}
+	}
+	_curBttnId = bttnId;
+
+	return;
+}
+
+void AnlgLddrInptBnk::end(){
+	setSnpshtUpd(false);
+	_MpbCrtclSctnBgn();
+	if(_bnkActv){
+		_bnkActv = false;
+		--_actvBnksQty;
+	}
+	if(_adcOwnrPtr == this)
+		_adcOwnrPtr = nullptr;
+	_cnvrsnStrtd = false;
+	_MpbCrtclSctnEnd();
+
+	return;
+}
+
+uint16_t AnlgLddrInptBnk::getAdcVal(){
+
+	return _adcVal;
+}
+
+uint8_t AnlgLddrInptBnk::getCurBttnId(){
+
+	return _curBttnId;
+}
+
+bool AnlgLddrInptBnk::getInptLvl(const uint8_t &inptId){
+
+	return (inptId == _curBttnId)?LOW:HIGH;
+}
+
+bool AnlgLddrInptBnk::setWndw(const uint8_t &bttnId, const uint16_t &wndwMin, const uint16_t &wndwMax){
+	bool result {false};
+
+	if((bttnId < _bttnsQty) && (wndwMin <= wndwMax)){
+		_MpbCrtclSctnBgn();
+		*(_wndws + (2 * bttnId)) = wndwMin;
+		*(_wndws + (2 * bttnId) + 1) = wndwMax;
+		_MpbCrtclSctnEnd();
+		result = true;
+	}
+
+	return result;
+}
+
+void AnlgLddrInptBnk::updSnpsht(){
+#if defined(__AVR__) && defined(ADCSRA)
+	if((_adcOwnrPtr == nullptr) || !(_adcOwnrPtr->getSnpshtUpd()))	// The converter is free, or held by a bank no longer updated: it's taken by this bank
+		_adcOwnrPtr = this;
+	if(_adcOwnrPtr == this){
+		if(_cnvrsnStrtd){
+			if(!(ADCSRA & (1 << ADSC))){	// The conversion started in a previous timer interrupt is completed
+				if(ADMUX == _admuxVal){	// And the channel was not changed by other code
+					_adcVal = ADCW;
+					_clssfyVal();
+				}
+				_cnvrsnStrtd = false;
+				if(_actvBnksQty > 1)	// Round robin: the converter is released to be taken by the next bank updated, in this or the next timer interrupt
+					_adcOwnrPtr = nullptr;
+			}
+		}
+		if((_adcOwnrPtr == this) && !_cnvrsnStrtd && !(ADCSRA & (1 << ADSC))){	// Start the next conversion, it's result will be read in the next timer interrupt. A conversion in progress, started by a previous owner, is left to complete
+			ADMUX = _admuxVal;
+	#if defined(MUX5)
+			ADCSRB = _adcsrbVal;
+	#endif
+			ADCSRA |= (1 << ADSC);
+			_cnvrsnStrtd = true;
+		}
+	}
+#else
+	_adcVal = analogRead(_anlgPin);
+	_clssfyVal();
+#endif
+
+	return;
+}
+
+//=========================================================================> Class methods delimiter
+
 unsigned long int findMCD(unsigned long int a, unsigned long int b) {
    unsigned long int result{ 0 };
 
    if (a != 0 && b != 0) {
-		// Use Euclidean algorithm for efficiency
-		while (a != b) {
-			if (a > b)
-				a -= b;
-			else 
-				b -= a;
+		// Use the modulo version of the Euclidean algorithm, the iterations are logarithmic in the smaller value
+		while (b != 0) {
+			result = a % b;
+			a = b;
+			b = result;
 		}
 		result = a;
 	}
 
-	return result; // At this point, a and b are equal and represent the MCD
+	return result; // At this point, b is 0 and a represents the MCD
 }
 
 /**
@@ -3591,6 +7231,7 @@ unsigned long int findMCD(unsigned long int a, unsigned long int b) {
 	else
 		mpbCurSttsDcdd.isOnScndry = false;
 
+	mpbCurSttsDcdd.wrnngStg = (pkgOtpts >> WrnngStgBitPos) & 0x07;
 	mpbCurSttsDcdd.otptCurVal = (pkgOtpts & 0xffff0000) >> OtptCurValBitPos;
 
 	return mpbCurSttsDcdd;
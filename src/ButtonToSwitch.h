@@ -55,6 +55,12 @@
 #define _HwMinDbncTime 20   //Documented minimum wait time for a MPB signal to stabilize
 #define _StdPollDelay 10
 #define _MinSrvcTime 100
+#define _MaxSrvcTime 0x7FFFFFFFUL	// Timers deadlines are compared as signed time differences, longer settings would expire immediately, see DbncdMPBttn::_srvcTmrs()
+#define _DrtyMpbsMax 64	// Maximum number of objects tracked by the "dirty objects" bitmap, see DbncdMPBttn::popDrtyMpb()
+#define _CfgFrmtVer 2	// Configuration records format version, see DbncdMPBttn::getCfgRcrd()
+#define _CfgRcrdMax 64	// Maximum size in bytes of a single object configuration record, see DbncdMPBttn::getCfgRcrd()
+#define _WrnngStgsMax 4	// Maximum number of warning stages of a HntdTmLtchMPBttn object, see HntdTmLtchMPBttn::setWrnngStgs()
+#define _SttLstnrsMax 2	// Maximum number of state listeners notified by a single object, i.e. a radio buttons group and a chords detector, see DbncdMPBttn::addSttLstnr()
 #define _InvalidPinNum 0xFF	// Value to give as "yet to be defined", the "Valid pin number" range and characteristics are development platform and environment related
 
 /*---------- DbncdMPBttn complete status related constants, argument structs, information packing and unpacking BEGIN -------*/
@@ -64,6 +70,7 @@ const uint8_t PilotOnBitPos{2};
 const uint8_t WrnngOnBitPos{3};
 const uint8_t IsVoidedBitPos{4};
 const uint8_t IsOnScndryBitPos{5};
+const uint8_t WrnngStgBitPos{6};	// 3 bits field, bits 6 to 8
 const uint8_t OtptCurValBitPos{16};
 //===========================>> END General use constant definitions
 
@@ -83,10 +90,32 @@ const uint8_t OtptCurValBitPos{16};
 		bool isVoided;
 		bool isOnScndry;
 		uint16_t otptCurVal;
+		uint8_t wrnngStg;
 	};
 #endif
 /*---------------- DbncdMPBttn complete status related constants, argument structs, information packing and unpacking END -------*/
 
+/*---------------- GstrMPBttn gestures codes BEGIN -------*/
+const uint8_t GstrNone{0};
+const uint8_t GstrClck{1};
+const uint8_t GstrLngPrss{2};
+const uint8_t GstrHldRpt{3};
+/*---------------- GstrMPBttn gestures codes END -------*/
+
+/*---------------- SldrDALtchMPBttn acceleration curves codes BEGIN -------*/
+const uint8_t SldrAcclNone{0};
+const uint8_t SldrAcclLnr{1};
+const uint8_t SldrAcclExp{2};
+const uint8_t SldrAcclTbl{3};
+/*---------------- SldrDALtchMPBttn acceleration curves codes END -------*/
+
+/*---------------- SldrDALtchMPBttn output mapping tables codes BEGIN -------*/
+const uint8_t OtptMpLnr{0};
+const uint8_t OtptMpGmm22{1};
+const uint8_t OtptMpLog{2};
+const uint8_t OtptMpCstm{3};
+/*---------------- SldrDALtchMPBttn output mapping tables codes END -------*/
+
 // Definition workaround to let a function/method return value to be a function pointer
 typedef void (*fncPtrType)();
 typedef  fncPtrType (*ptrToTrnFnc)();
@@ -96,6 +125,11 @@ typedef  fncPtrType (*ptrToTrnFnc)();
  The resulting **fncVdPtrPrmPtrType** type then defines a pointer to a function of the described properties and signature*/
 typedef void (*fncVdPtrPrmPtrType)(void*);
 typedef fncVdPtrPrmPtrType (*ptrToTrnFncVdPtr)(void*);
+
+/* Definition workaround to let a function/method return value to be a function pointer
+ to a function that receives a void* argument and returns a boolean value: bool (funcName*)(void*) 
+ The resulting **fncBlVdPtrPrmPtrType** type then defines a pointer to a function of the described properties and signature, used to provide input signal levels*/
+typedef bool (*fncBlVdPtrPrmPtrType)(void*);
 //===========================>> BEGIN General use function prototypes
 MpbOtpts_t otptsSttsUnpkg(uint32_t pkgOtpts);
 unsigned long int findMCD(unsigned long int a, unsigned long int b);
@@ -116,6 +150,7 @@ unsigned long int findMCD(unsigned long int a, unsigned long int b);
  * - With every resume() invocation.
  * - With every end() invocation, taking care of the special case if the **"list of MPBs to keep updated"** is emptied (**_updTimerPeriod** = 0 and Timer1 stopped)
  * - With every pause() invocation, taking care of the special case if the **"list of MPBs to keep updated"** is emptied (**_updTimerPeriod** = 0 and Timer1 paused)
+ * - To avoid traversing the **"list of MPBs to keep updated"** and recalculating the MCD for every one of those invocations, the poll periods of the **timer attached** objects are kept in a static sorted list of distinct periods -pointed by **_actvPrdsLstPtr**- with the count of objects using each one -pointed by **_actvPrdsCntLstPtr**-, and their MCD -**_actvPrdsMCD**- is updated incrementally: attaching an object costs one MCD calculation at most, detaching an object only recalculates the MCD of the distinct periods when the last object using a period is detached.
  * 
  *  The callback function duties:
  * - Verify for a valid **_mpbsInstncsLstPtr**, if it's nullptr something failed, correct it by disabling the timer
@@ -128,6 +163,10 @@ unsigned long int findMCD(unsigned long int a, unsigned long int b);
 
 //==========================================================>> Classes declarations BEGIN
 
+class MpbInptPrvdr;
+class MpbSttLstnr;
+class ShftRgstrOtptBnk;
+
 /**
  * @brief Base class, models a Debounced Momentary Push Button (**D-MPB**).
  *
@@ -138,7 +177,17 @@ unsigned long int findMCD(unsigned long int a, unsigned long int b);
  * @class DbncdMPBttn
  */
 class DbncdMPBttn{
+	friend class MpbBnk;
+	friend class MpbPrstnc;
+	friend class MpbRdGrp;
+
+	static unsigned long int* _actvPrdsLstPtr;
+	static uint16_t* _actvPrdsCntLstPtr;
+	static unsigned long int _actvPrdsMCD;
+	static uint8_t _actvPrdsQty;
+	static volatile uint32_t _drtyMsk[_DrtyMpbsMax / 32];
 	static DbncdMPBttn** _mpbsInstncsLstPtr;
+	static volatile uint32_t _sttsGnrtn;
 	static unsigned long int _updTimerPeriod;
 /*
  * This is the callback function to be executed by the TimerOne managed timer INT.
@@ -152,6 +201,11 @@ class DbncdMPBttn{
  * 	- Set _lstPollTime = "current time" * 
  */
 	static void _ISRMpbsRfrshCb();
+	static void _addActvPrd(const unsigned long int &prd);
+	static void _rbldDrtyMsk();
+	static void _rmvActvPrd(const unsigned long int &prd);
+	static void _srvcTmrs(const unsigned long int &curTm);
+	static void _updTmrPrd();
 
 protected:
 	enum fdaDmpbStts {
@@ -161,18 +215,47 @@ protected:
 		stOnVRP,
 		stDisabled
 	};
+	/*Deadline timer of the shared soft-timers service. The armed timers are kept in a single list sorted by deadline, so the
+	timer interrupt service checks only the list head each tick, and the timers owners check just the expired flag instead of
+	computing the time elapsed every poll. The deadlines must be less than 2^31 milliseconds (~24.8 days) away*/
+	struct mpbTmr_t{
+		unsigned long int ddln{0};
+		mpbTmr_t* nxt{nullptr};
+		bool armd{false};
+		volatile bool expd{false};
+	};
+	static mpbTmr_t* _tmrsLstHd;
+	/*Output attribute flag bound to a GPIO pin, written from the timer interrupt service at the moment the flag changes.
+	In AVR architectures the port register and bit mask are resolved once at binding time*/
+	struct mpbOtptPin_t{
+		uint8_t pin{_InvalidPinNum};	// GPIO pin number, or output index when bound to an output bank
+		bool actvHgh{true};
+		ShftRgstrOtptBnk* otptBnk{nullptr};
+#if defined(__AVR__)
+		volatile uint8_t* portReg{nullptr};
+		uint8_t pinMsk{0};
+#endif
+	};
 	const unsigned long int _stdMinDbncTime {_HwMinDbncTime};
 
+	unsigned long int _actvPrd{0};
+
 	uint8_t _mpbttnPin{};
 	bool _pulledUp{};
 	bool _typeNO{};
 	unsigned long int _dbncTimeOrigSett{};
 
 	bool _beginDisabled{false};
+	bool _dbncRlsAuto{false};
 	unsigned long int _dbncRlsTimerStrt{0};
 	unsigned long int _dbncRlsTimeTempSett{0};
 	unsigned long int _dbncTimerStrt{0};
 	unsigned long int _dbncTimeTempSett{0};
+	uint8_t _fltrPrssdCnt{0};
+	uint16_t _fltrSmplsMsk{0};
+	uint8_t _fltrSmplsQty{0};
+	uint16_t _fltrSmplsReg{0};
+	uint8_t _fltrVtsQty{0};
 	fncVdPtrPrmPtrType _fnVdPtrPrmWhnTrnOff{nullptr};	// _fVPPWhnTrnOff
 	void* _fnVdPtrPrmWhnTrnOffArgPtr{nullptr};	// _fVPPWhnTrnOffArgPtr
 	fncVdPtrPrmPtrType _fnVdPtrPrmWhnTrnOn{nullptr};	// _fVPPWhnTrnOn
@@ -180,40 +263,62 @@ protected:
 	void (*_fnWhnTrnOff)() {nullptr};
 	void (*_fnWhnTrnOn)() {nullptr};
 
+	MpbInptPrvdr* _inptPrvdr{nullptr};
+	fncBlVdPtrPrmPtrType _inptFnc{nullptr};
+	void* _inptFncArgPtr{nullptr};
 	bool _isEnabled{true};
 	volatile bool _isOn{false};
 	bool _isOnDisabled{false};
 	volatile bool _isPressed{false};
+	bool _inUpdLst{false};
 	unsigned long int _lstPollTime{0};
+	uint8_t _lstIdx{0xFF};
 	fdaDmpbStts _mpbFdaState {stOffNotVPP};
 	DbncdMPBttn* _mpbInstnc{nullptr};
+	mpbOtptPin_t* _otptPinsPtr{nullptr};	// Allocated at the first binding, one entry for each output attribute flag bit position
+	uint8_t _otptPinsWrttn{0};	// Output attribute flags values as last written to the bound pins
 	volatile bool _outputsChange {false};
 	uint32_t _outputsChangeCnt{0};
 	unsigned long int _pollPeriodMs{0};
 	bool _prssRlsCcl{false};
+	unsigned long int _rlsDelay {0};
 	unsigned long int _strtDelay {0};
 	bool _sttChng {true};
+	MpbSttLstnr* _sttLstnrs[_SttLstnrsMax]{nullptr};
+	volatile uint32_t _sttsGnrtnStmp{0};
 	bool _updTmrAttchd{false};
 	volatile bool _validDisablePend{false};
 	volatile bool _validEnablePend{false};
 	volatile bool _validPressPend{false};
 	volatile bool _validReleasePend{false};
 
+	static void _armTmr(mpbTmr_t &tmr, const unsigned long int &ddln);
+	static uint16_t _calcCfgCrc(const uint8_t* bufPtr, const uint16_t &bufSz);
+	virtual void _cfgPkg(uint8_t* &bufPtr);
+	virtual bool _cfgUnpkg(const uint8_t* &bufPtr);
    void clrSttChng();
+	static void _dsrmTmr(mpbTmr_t &tmr);
+	bool _fltrGlitch(const bool &rawIsPressed);
+	virtual uint8_t _getCfgClsId();
 	const bool getIsPressed() const;
+	static unsigned long int _getTmrRmnng(const mpbTmr_t &tmr);
 	virtual void mpbPollCallback();
 	virtual uint32_t _otptsSttsPkg(uint32_t prevVal = 0);
-	void _popMpb(DbncdMPBttn** &DMpbTmrUpdLst, DbncdMPBttn* mpbToPop);
-	void _pushMpb(DbncdMPBttn** &DMpbTmrUpdLst, DbncdMPBttn* mpbToPush);
+	static void _popMpb(DbncdMPBttn** &DMpbTmrUpdLst, DbncdMPBttn* mpbToPop);
+	static void _pushMpb(DbncdMPBttn** &DMpbTmrUpdLst, DbncdMPBttn* mpbToPush);
+	virtual void _rstrSttsPkg(const uint32_t &){};
 	void _setIsEnabled(const bool &newEnabledValue);
+	void _setUpdTmrAttchd(const bool &newUpdTmrAttchd);
 	void _setLstPollTime(const unsigned long int &newLstPollTIme);
 	void setSttChng();
 	void _turnOff();
 	void _turnOn();
+	static void _unlnkTmr(mpbTmr_t &tmr);
 	virtual void updFdaState();
 	bool updIsPressed();
-	unsigned long int _updTmrsMCDCalc();
+	static unsigned long int _updTmrsMCDCalc();
 	virtual bool updValidPressesStatus();
+	void _wrtOtptPins(const bool &frcWrt = false);
 
 public:    
 	/**
@@ -241,6 +346,20 @@ public:
  *
  */
 	virtual ~DbncdMPBttn();
+	/**
+	 * @brief Adds a state listener object to be notified of the object's **isOn** attribute flag changes.
+	 *
+	 * The state listener (a MpbSttLstnr subclass object) is notified from inside the object's state update, after the **isOn** attribute flag value changed and the functions set to be executed when turning On or Off were executed. This lets objects that coordinate several MPBs -radio groups, chord detectors, etc.- react in the same timer interrupt service the change took place, with no need to poll the MPBs from the loop.
+	 *
+	 * Up to _SttLstnrsMax state listeners might be set for each object, so an object might be a member of a radio buttons group and of a chords detector at the same time. The listeners are notified in the order they were added.
+	 *
+	 * @param newSttLstnr Pointer to the state listener object.
+	 *
+	 * @return A boolean indicating the success of the operation.
+	 * @retval true: the state listener was added, or it was already set.
+	 * @retval false: the pointer was nullptr, or all the state listener slots are taken, no change was made.
+	 */
+	bool addSttLstnr(MpbSttLstnr* newSttLstnr);
 	/**
 	 * @brief Attaches the instantiated object to a timer that monitors the input pins and updates the object status.
 	 * 
@@ -268,8 +387,10 @@ public:
 	 *
 	 * - true: (default value) includes the isOn flag.
 	 * - false: excludes the isOn flag.
+	 *
+	 * @note The method is virtual, each subclass clears it's own specific flags, timers and counters -latch, service, warning, voiding, etc.- before invoking it's superclass implementation, so the complete clearing is done even when invoked through a DbncdMPBttn pointer (i.e. by the MpbBnk::clrStatus(bool) method).
 	 */
-	void clrStatus(bool clrIsOn = true);
+	virtual void clrStatus(bool clrIsOn = true);
    /**
 	 * @brief Disables the input signal processing, ignoring the changes of its values.
 	 *
@@ -305,6 +426,35 @@ public:
 	 * @retval false: the object detachment and/or entry removal was rejected.
 	 */
 	bool end();    
+	/**
+	 * @brief Builds a single configuration blob with the configuration records of a set of objects.
+	 *
+	 * The blob holds a header (format version and number of records), the configuration records of each object in order -see getCfgRcrd(uint8_t*, const uint8_t)-, and a CRC-16 of all the previous bytes. The blob might be saved to EEPROM or transmitted, and applied back in a single call by the setCfgBlob() method.
+	 *
+	 * @param bufPtr Pointer to the buffer where the blob will be written.
+	 * @param bufSz Size of the buffer in bytes. Each object needs up to _CfgRcrdMax bytes, plus 4 bytes for the blob header and CRC.
+	 * @param mpbsArr Pointer to an array of pointers to the objects to include. If nullptr, the objects included are the ones in the **"list of MPBs to keep updated"**, in the order their begin() method was invoked.
+	 * @param mpbsQty Number of objects in the mpbsArr array, ignored if mpbsArr is nullptr.
+	 *
+	 * @return The size in bytes of the blob written.
+	 * @retval 0 the buffer was not big enough or there were no objects to include, the buffer content is not valid.
+	 */
+	static uint16_t getCfgBlob(uint8_t* bufPtr, const uint16_t &bufSz, DbncdMPBttn** mpbsArr = nullptr, const uint8_t &mpbsQty = 0);
+	/**
+	 * @brief Builds the object's configuration record.
+	 *
+	 * The configuration record is a compact binary image of the object's tunable attributes (debounce and delay times, unlatch settings, service time, warning percentage, void time, slider limits, etc. depending on the object's class), to be saved or transmitted and applied back by the setCfgRcrd(const uint8_t*, const uint8_t) method, avoiding the one by one setters invocations at start up.
+	 * The record holds it's own size, the format version (_CfgFrmtVer), a class layout identifier and a CRC-16 of the previous bytes, so corrupted records and records built by different classes or library versions are rejected when applied.
+	 *
+	 * @param bufPtr Pointer to the buffer where the record will be written.
+	 * @param bufSz Size of the buffer in bytes, the records are never bigger than _CfgRcrdMax bytes.
+	 *
+	 * @return The size in bytes of the record written.
+	 * @retval 0 the buffer was not big enough, nothing was written.
+	 *
+	 * @note The attributes referencing memory (custom tables pointers, functions pointers) and pins bindings are not part of the record.
+	 */
+	uint8_t getCfgRcrd(uint8_t* bufPtr, const uint8_t &bufSz);
 	/**
 	 * @brief Returns the current debounce period time set for the object.
 	 *
@@ -313,6 +463,30 @@ public:
 	 * @return The current debounce time in milliseconds
 	 */
 	const unsigned long int getCurDbncTime() const;
+	/**
+	 * @brief Returns the current release debounce period time set for the object.
+	 *
+	 * The release debounce time is the time the MPB must be kept **continuously released** before the release is considered valid. The value might be changed with the **setDbncRlsTime(const unsigned long int)** method, or be kept equal to the press debounce time by the **setDbncRlsAuto(const bool)** method. At instantiation the release debounce time is set to 0 (zero), to keep backwards compatibility to old versions of the library.
+	 *
+	 * @return The current release debounce time in milliseconds
+	 */
+	const unsigned long int getCurDbncRlsTime() const;
+	/**
+	 * @brief Returns the value of the **dbncRlsAuto** attribute flag.
+	 *
+	 * @retval true: the release debounce time is automatically kept equal to the press debounce time.
+	 * @retval false: the release debounce time is independent of the press debounce time.
+	 */
+	const bool getDbncRlsAuto() const;
+	/**
+	 * @brief Returns if any object in the **"list of MPBs to keep updated"** has it's outputs changed and not yet retrieved by the popDrtyMpb() method.
+	 *
+	 * The check is done on the "dirty objects" bitmap, so it takes a couple of words comparisons whatever the number of objects is.
+	 *
+	 * @retval true: at least one object is "dirty", the popDrtyMpb() method will return a valid pointer.
+	 * @retval false: no object is "dirty".
+	 */
+	static bool getDrtyMpbs();
 	/**
 	 * @brief Returns the function that is set to execute every time the object **enters** the **Off State**.
 	 *
@@ -365,6 +539,34 @@ public:
 	 * @return void* Pointer to the argument to be passed to the function set to execute every time the object enters the **On State**.
 	 */
 	void* getFVPPWhnTrnOnArgPtr();
+	/**
+	 * @brief Returns a pointer to the function set as the input signal source for the object.
+	 *
+	 * @return The pointer to the function set to provide the input signal level.
+	 * @retval nullptr if there is no function set as input signal source.
+	 */
+	fncBlVdPtrPrmPtrType getInptFnc();
+	/**
+	 * @brief Returns a pointer to the input provider object set as the input signal source for the object.
+	 *
+	 * @return The pointer to the input provider object.
+	 * @retval nullptr if there is no input provider object set as input signal source.
+	 */
+	MpbInptPrvdr* getInptPrvdr();
+	/**
+	 * @brief Returns the number of input samples kept by the glitch filter.
+	 *
+	 * @return The size of the glitch filter samples window (M).
+	 * @retval 0: the glitch filter is not active.
+	 */
+	uint8_t getGlitchFltrSmpls();
+	/**
+	 * @brief Returns the number of coincident input samples required by the glitch filter to report a new input level.
+	 *
+	 * @return The glitch filter votes threshold (N).
+	 * @retval 0: the glitch filter is not active.
+	 */
+	uint8_t getGlitchFltrVts();
 /**
 	 * @brief Returns the value of the isEnabled attribute flag, indicating the **Enabled** or **Disabled** status of the object.
 	 *
@@ -403,6 +605,28 @@ public:
 	 * @return An unsigned long int representing the time stamp in milliseconds for the last time the state update was executed for the current object.
 	 */
 	const unsigned long int getLstPollTime();
+	/**
+	 * @brief Returns the earliest pending deadline among all the running timers of all the MPB objects.
+	 *
+	 * The service, warning, second mode activation and void timers of all the instantiated objects are kept in a single list sorted by deadline, so the earliest one is found at the head of the list whatever the number of running timers is. The value can be used to schedule the next display refresh or the next wake up from a low power mode.
+	 *
+	 * @param ddln Reference to the variable where the earliest deadline will be stored, as a millis() time stamp. The variable is not modified if there's no timer running.
+	 *
+	 * @retval true: at least one timer is running, ddln holds the earliest deadline.
+	 * @retval false: no timer is running.
+	 *
+	 * @note The deadline might be already reached but not yet serviced by the timer interrupt, the (long)(ddln - millis()) value should be checked for negative values.
+	 */
+	static bool getNxtDdln(unsigned long int &ddln);
+	/**
+	 * @brief Returns the GPIO pin bound to an output attribute flag.
+	 *
+	 * @param otptBitPos Bit position of the output attribute flag in the packaged status value, as defined by the IsOnBitPos, PilotOnBitPos, WrnngOnBitPos, IsVoidedBitPos and IsOnScndryBitPos constants.
+	 *
+	 * @return The pin number bound to the flag.
+	 * @retval _InvalidPinNum if no pin is bound to the flag or the otptBitPos parameter is out of range.
+	 */
+	uint8_t getOtptPin(const uint8_t &otptBitPos);
    /**
     * @brief Returns the relevant attribute flags values for the object state encoded as a 32 bits value.
 	 * 
@@ -432,6 +656,14 @@ public:
 	 * @return The time setting for the poll period time in milliseconds.
 	 */
 	const unsigned long int getPollPeriodMs();
+	/**
+	 * @brief Returns the current value of the rlsDelay attribute.
+	 *
+	 * Returns the current value of time used by the object to validate a release, added to the release debounce time, in milliseconds. If the MPB is pressed again before completing the release debounce **and** the rlsDelay time, no release will be detected by the object, and the isOn flag will not be affected.
+	 *
+	 * @return The current rlsDelay time in milliseconds.
+	 */
+	unsigned long int getRlsDelay();
    /**
     * @brief Returns the current value of strtDelay attribute.
     *
@@ -442,6 +674,39 @@ public:
     * @attention The strtDelay attribute is forced to a 0 ms value at instantiation of DbncdMPBttn class objects, and no setter mechanism is provided in this class. The inherited DbncdDlydMPBttn class objects (and all it's subclasses) constructor includes a parameter to initialize the strtDelay value, and a method to set that attribute to a new value. This implementation is needed to keep backwards compatibility to old versions of the library.
     */
 	unsigned long int getStrtDelay();
+	/**
+	 * @brief Returns a pointer to a state listener object set to be notified of the object's **isOn** attribute flag changes.
+	 *
+	 * @param lstnrIdx (Optional) Index of the state listener slot, valid range is 0 to (_SttLstnrsMax - 1). Default value is 0.
+	 *
+	 * @return The pointer to the state listener object.
+	 * @retval nullptr if there is no state listener object set in the slot, or the index is out of range.
+	 */
+	MpbSttLstnr* getSttLstnr(const uint8_t &lstnrIdx = 0);
+	/**
+	 * @brief Returns the current value of the status generation number.
+	 *
+	 * The status generation number is a value common to all the DbncdMPBttn class and subclasses objects, incremented every time any object's **outputsChange** attribute flag is set -see setOutputsChange(bool)-. Each object keeps the generation number of it's last outputs change, so the objects changed since a reference moment might be identified by comparing their generation number with the generation number at that moment, see getSttsSnpsht(uint32_t*, DbncdMPBttn**, const uint8_t, uint32_t&, const uint32_t).
+	 *
+	 * @return The current status generation number.
+	 */
+	static uint32_t getSttsGnrtn();
+	/**
+	 * @brief Copies the packaged status of the objects in the **"list of MPBs to keep updated"** to an array, all of them read at the same moment.
+	 *
+	 * Reading the status of several objects through individual getOtptsSttsPkgd() invocations might get each of them in a different timer interrupt service, giving an inconsistent set of values. This method gets all the packaged status values inside a single critical section, so no object's status is updated while they are read, and the values copied represent the whole set of objects at a single moment.
+	 *
+	 * @param sttsArr Pointer to the array where the packaged status values will be copied, see getOtptsSttsPkgd().
+	 * @param mpbsArr Pointer to an array where the pointers to the objects whose status was copied will be saved, in the same order as the sttsArr elements. If nullptr is passed, the pointers are not saved.
+	 * @param arrSz Number of elements of the arrays.
+	 * @param gnrtn Variable where the status generation number at the moment of the copy will be saved, to be used as the **sncGnrtn** parameter of the next invocation.
+	 * @param sncGnrtn Status generation number reference: only the objects whose outputs changed after that generation number are copied. A 0 value copies all the objects.
+	 *
+	 * @return The number of objects that satisfied the sncGnrtn condition. If the value is greater than arrSz, only the first arrSz objects were copied.
+	 *
+	 * @note The objects are copied in the order they were included in the **"list of MPBs to keep updated"**, see begin(const unsigned long int).
+	 */
+	static uint8_t getSttsSnpsht(uint32_t* sttsArr, DbncdMPBttn** mpbsArr, const uint8_t &arrSz, uint32_t &gnrtn, const uint32_t &sncGnrtn = 0);
 	/**
 	 * @brief Returns the value of the **Attached to the update timer** attribute.
 	 * 
@@ -469,6 +734,24 @@ public:
 	 * @note For better understanding on the timer update mechanism used and it's management see begin(const unsigned long int) for details.
 	 */
 	bool pause();
+	/**
+	 * @brief Returns a pointer to the next "dirty" object, clearing it's "dirty" condition and it's **outputsChange** attribute flag.
+	 *
+	 * The library keeps a "dirty objects" bitmap, one bit for each object in the **"list of MPBs to keep updated"**, set every time the object's **outputsChange** attribute flag is set, and cleared when the flag is reset. This method returns the first object with it's bit set, clearing the bit and the object's outputsChange flag in the same critical section, so the loop code might process only the objects that changed with no need to check each object's getOutputsChange() value:
+	 * @code
+	 * DbncdMPBttn* mpbPtr {nullptr};
+	 * while((mpbPtr = DbncdMPBttn::popDrtyMpb()) != nullptr){
+	 *    // Process mpbPtr outputs changes
+	 * }
+	 * @endcode
+	 *
+	 * @return A pointer to a "dirty" object.
+	 * @retval nullptr: no object is "dirty".
+	 *
+	 * @note The object's **outputsChange** attribute flag is reset by the method, so a later rebuild of the bitmap -done when objects are added to or removed from the list- doesn't report the object again. The getOutputsChange() method will return false for the popped object until it's outputs change again.
+	 * @note Only the first _DrtyMpbsMax objects included in the **"list of MPBs to keep updated"** are tracked by the bitmap, the rest of the objects must be checked by the getOutputsChange() method.
+	 */
+	static DbncdMPBttn* popDrtyMpb();
 	/**
 	 * @brief Resets the debounce process time of the object to the value used at instantiation.
 	 *
@@ -492,6 +775,15 @@ public:
 	 * @warning This method will restart the inactive timer after a **pause()** method. If the object's timer was modified by an **end()* method then a **begin()** method will be needed to restart it's timer.
 	 */
 	bool resume();
+	/**
+	 * @brief Removes a state listener object from the ones notified of the object's **isOn** attribute flag changes.
+	 *
+	 * @param sttLstnr Pointer to the state listener object to remove.
+	 *
+	 * @retval true: the state listener was set, and it was removed.
+	 * @retval false: the state listener was not set for the object.
+	 */
+	bool rmvSttLstnr(MpbSttLstnr* sttLstnr);
 	/**
 	 * @brief Sets the starting isDisabled state
 	 * 
@@ -512,6 +804,56 @@ public:
 	 * @retval false: the value was out of the accepted range, no change was made.
 	 */
 	bool setDbncTime(const unsigned long int &newDbncTime);
+	/**
+	 * @brief Applies a configuration blob built by the getCfgBlob() method to a set of objects.
+	 *
+	 * The blob CRC is verified first, then each record is applied to the object in the same position of the set, see setCfgRcrd(const uint8_t*, const uint8_t).
+	 *
+	 * @param blobPtr Pointer to the blob.
+	 * @param blobSz Size of the blob in bytes.
+	 * @param mpbsArr Pointer to an array of pointers to the objects to configure. If nullptr, the objects configured are the ones in the **"list of MPBs to keep updated"**, in the order their begin() method was invoked.
+	 * @param mpbsQty Number of objects in the mpbsArr array, ignored if mpbsArr is nullptr.
+	 *
+	 * @return The number of records applied with all their values accepted, see setCfgRcrd(const uint8_t*, const uint8_t).
+	 * @retval 0 the blob was not valid (wrong CRC, format version or size) or no record could be applied.
+	 *
+	 * @note The set of objects must be the same, in the same order, as the one used to build the blob. A record that doesn't match the class of the object in it's position is skipped.
+	 */
+	static uint8_t setCfgBlob(const uint8_t* blobPtr, const uint16_t &blobSz, DbncdMPBttn** mpbsArr = nullptr, const uint8_t &mpbsQty = 0);
+	/**
+	 * @brief Applies a configuration record built by the getCfgRcrd(uint8_t*, const uint8_t) method.
+	 *
+	 * The record is verified (size, format version, class layout identifier and CRC-16) before any attribute is modified. Each attribute is then set through it's setter method, so the same validations and side effects of the individual setters invocations apply.
+	 *
+	 * @param rcrdPtr Pointer to the record.
+	 * @param rcrdSz Size of the record in bytes.
+	 *
+	 * @retval true the record was valid and all it's values were accepted by the setters.
+	 * @retval false the record was not valid or was built for a different class, nothing was changed. Also returned when the record was valid but at least one of it's values was rejected by it's setter, the attributes of the rejected values keep their previous values while the rest of the record is applied.
+	 */
+	bool setCfgRcrd(const uint8_t* rcrdPtr, const uint8_t &rcrdSz);
+	/**
+	 * @brief Sets the release debounce time to be kept equal to the press debounce time.
+	 *
+	 * When the **dbncRlsAuto** attribute flag is set the release debounce time is set to the current press debounce time, and will follow every further change made to it through the setDbncTime(const unsigned long int) and resetDbncTime() methods. Setting a release debounce time value through the setDbncRlsTime(const unsigned long int) method resets the flag.
+	 *
+	 * @param newDbncRlsAuto The new value for the **dbncRlsAuto** attribute flag.
+	 *
+	 * @note When the flag is reset the release debounce time keeps the last value it had, no change is made to it.
+	 */
+	void setDbncRlsAuto(const bool &newDbncRlsAuto);
+	/**
+	 * @brief Sets the release debounce process time.
+	 *
+	 * Sets a new time for the release debouncing period. The value must be equal or greater than the minimum empirical value set as a property for all the classes, that value is defined in the _HwMinDbncTime constant (20 milliseconds), or 0 (zero) to validate the release at the first poll that finds the MPB released, as it was done in previous versions of the library. A long release debounce time will produce a delay in the release event generation.
+	 *
+	 * @param newDbncRlsTime unsigned long integer, the new release debounce value for the object.
+	 *
+	 * @return	A boolean indicating if the release debounce time setting was successful.
+	 * @retval true: the new value is in the accepted range, the attribute value is updated and the **dbncRlsAuto** attribute flag is reset.
+	 * @retval false: the value was out of the accepted range, no change was made.
+	 */
+	bool setDbncRlsTime(const unsigned long int &newDbncRlsTime);
 	/**
 	 * @brief Sets the function that will be called to execute every time the object **enters** the **Off State**.
 	 *
@@ -562,6 +904,48 @@ public:
 	 * @param newFVPPWhnTrnOnArgPtr Pointer to an argument to be passed to the function set to execute every time the object enters the **On State**.
 	 */
 	void setFVPPWhnTrnOnArgPtr(void* newFVPPWhnTrnOnArgPtr);
+	/**
+	 * @brief Sets the N-of-M glitch filter parameters.
+	 *
+	 * The glitch filter is an optional stage placed between the input pin reading and the debouncing process. It keeps the last **smplsQty** (M) input readings, and changes the pressed/released level delivered to the debouncing process only when at least **vtsQty** (N) of those readings agree on the new level, otherwise the last delivered level is kept. Single sample spikes, as the ones induced by EMI on long cable runs, are so rejected without restarting the debounce timers, and without modifying the debounce times settings.
+	 *
+	 * @param smplsQty Number of input readings kept by the filter (M), valid range is 2 to 16. Passing 0 (zero) deactivates the filter.
+	 * @param vtsQty Number of coincident readings required to report a level (N), valid range is (M/2 + 1) to M, so that only one level might have the majority.
+	 *
+	 * @return A boolean indicating if the filter setting was successful.
+	 * @retval true: the parameters were valid, the filter is set (or deactivated) and its samples register cleared.
+	 * @retval false: the parameters were out of the accepted ranges, no change was made.
+	 *
+	 * @note Each reading is taken at the object's poll period, so the filter adds up to (N - 1) poll periods of latency to each input level change. This should be considered when setting the poll period and the debounce times.
+	 */
+	bool setGlitchFltr(const uint8_t &smplsQty, const uint8_t &vtsQty);
+	/**
+	 * @brief Sets a function as the input signal source for the object.
+	 *
+	 * By default the input signal level is read from the GPIO pin set as **mpbttnPin**. Setting an input function replaces that reading by the value returned by the function, making possible to use software generated signals, signals received from other devices, etc. The function must be of the form **bool (*newInptFnc)(void*)**, it will be called once every time the object's status is updated, and it must return the **level** of the input signal (HIGH or LOW), that will be processed exactly as a GPIO pin level according to the **pulledUp** and **typeNO** attributes values.
+	 *
+	 * @param newInptFnc Function pointer to the function to be used as input signal source. Passing **nullptr** as parameter restores the GPIO pin reading.
+	 * @param argPtr void pointer to an argument to be passed to the function when it is called. It replaces the argument previously set even when the same function is set again.
+	 *
+	 * @note Setting an input function resets any input provider object previously set, see setInptPrvdr(MpbInptPrvdr*).
+	 *
+	 * @attention The input signal source must be set before the begin() method is invoked, as it's used to decide if the **mpbttnPin** must be configured as a GPIO input pin.
+	 *
+	 * @warning The function will be executed as part of the timer interrupt service, it must be kept short and must not rely on resources that need interrupts to be enabled.
+	 */
+	void setInptFnc(fncBlVdPtrPrmPtrType newInptFnc, void* argPtr = nullptr);
+	/**
+	 * @brief Sets an input provider object as the input signal source for the object.
+	 *
+	 * By default the input signal level is read from the GPIO pin set as **mpbttnPin**. Setting an input provider (a MpbInptPrvdr subclass object) replaces that reading by the level returned by the provider for the input identified by the **mpbttnPin** value, that is used as the input index in the provider, and not as a GPIO pin number. The level returned is processed exactly as a GPIO pin level according to the **pulledUp** and **typeNO** attributes values.
+	 *
+	 * @param newInptPrvdr Pointer to the input provider object. Passing **nullptr** as parameter restores the GPIO pin reading.
+	 *
+	 * @note Setting an input provider resets any input function previously set, see setInptFnc(fncBlVdPtrPrmPtrType, void*).
+	 *
+	 * @attention The input signal source must be set before the begin() method is invoked, as it's used to decide if the **mpbttnPin** must be configured as a GPIO input pin.
+	 */
+	void setInptPrvdr(MpbInptPrvdr* newInptPrvdr);
    /**
 	 * @brief Sets the value of the **isOnDisabled** attribute.
 	 *
@@ -579,8 +963,71 @@ public:
 	 * The usual path for the **outputsChange** flag is to be set by any method changing an output attribute flag, the callback function signaled to take care of the hardware actions because of this changes clears back **outputsChange** after taking care of them. In the unusual case the developer wants to "intercept" this sequence, this method is provided to set (true) or clear (false) outputsChange value.
     *
     * @param newOutputChange The new value to set the **outputsChange** flag to.
+    *
+    * @note Setting the flag increments the status generation number and saves it as the object's generation number, see getSttsGnrtn().
+    * @note Setting or resetting the flag sets or clears the object's bit in the "dirty objects" bitmap, see popDrtyMpb().
     */
 	void setOutputsChange(bool newOutputsChange);
+	/**
+	 * @brief Binds an output attribute flag to a GPIO pin.
+	 *
+	 * The usual way to reflect an output attribute flag in a pin is checking the getOutputsChange() value in the loop() and writing the pin, adding the loop period to the output latency. A bound pin is written from the timer interrupt service at the moment the flag changes, with no code needed in the loop(), so the latency is limited to the poll period.
+	 * The binding is available for every output attribute flag of the object's class: isOn for all the classes, pilotOn and wrnngOn for the HntdTmLtchMPBttn class, isOnScndry for the DblActnLtchMPBttn subclasses, and isVoided for the VdblMPBttn subclasses.
+	 *
+	 * @param otptBitPos Bit position of the output attribute flag in the packaged status value, as defined by the IsOnBitPos, PilotOnBitPos, WrnngOnBitPos, IsVoidedBitPos and IsOnScndryBitPos constants.
+	 * @param pin GPIO pin to be bound to the flag. The pin is set as OUTPUT and written with the flag's current value. Passing _InvalidPinNum as parameter removes the binding, the pin level and mode are not modified.
+	 * @param actvHgh Pin level for the set flag: true sets the pin HIGH when the flag is set, false sets the pin LOW when the flag is set.
+	 *
+	 * @retval true the parameters were valid and the binding was set or removed.
+	 * @retval false the otptBitPos parameter was out of range, the pin is not a valid digital pin of the board (AVR architectures only), or there was no memory available for the bindings, nothing was changed.
+	 *
+	 * @note In AVR architectures the pin port register and bit mask are resolved once at binding time, the pin is written by direct port access. As the direct port writes don't stop a PWM signal generated by a timer on the pin, the pin is written once with digitalWrite() when bound, stopping any PWM running on it. A PWM started on the pin by other code after the binding will override the written levels.
+	 * @note Objects built with the copy constructor don't copy the source object bindings.
+	 */
+	bool setOtptPin(const uint8_t &otptBitPos, const uint8_t &pin, const bool &actvHgh = true);
+	/**
+	 * @brief Binds an output attribute flag to an output of a shift registers output bank.
+	 *
+	 * The flag is bound the same way setOtptPin(const uint8_t, const uint8_t, const bool) binds it to a GPIO pin, but the output level is written to the bank's outputs image, and the whole chain is transferred once at the end of the timer interrupt service, see ShftRgstrOtptBnk.
+	 *
+	 * @param otptBitPos See setOtptPin(const uint8_t, const uint8_t, const bool)
+	 * @param otptBnk Pointer to the output bank holding the output. Passing nullptr as parameter removes the binding, the bank output previously bound is set LOW in the outputs image.
+	 * @param otptId Index of the output in the bank, in the 0 <= otptId < min(otptBnk->getOtptsQty(), 255) range.
+	 * @param actvHgh See setOtptPin(const uint8_t, const uint8_t, const bool)
+	 *
+	 * @retval true the parameters were valid and the binding was set or removed.
+	 * @retval false the otptBitPos or otptId parameters were out of range, or there was no memory available for the bindings, nothing was changed.
+	 */
+	bool setOtptPin(const uint8_t &otptBitPos, ShftRgstrOtptBnk* otptBnk, const uint8_t &otptId, const bool &actvHgh = true);
+	/**
+	 * @brief Sets a new value to the "Release Delay" **rlsDelay** attribute
+	 *
+	 * The release delay is added to the release debounce time, the MPB must be kept released for the sum of both times for the release to be considered valid.
+	 *
+	 * @param newRlsDelay New value for the "Release Delay" attribute in milliseconds.
+	 *
+	 * @warning: Using very high **rlsDelay** values is valid but might make the system behavior less responsive, be aware of how it will affect the user experience.
+	 */
+	void setRlsDelay(const unsigned long int &newRlsDelay);
+	/**
+	 * @brief Waits until any object, or any object of a subset of objects, in the **"list of MPBs to keep updated"** has it's outputs changed, or until a timeout is reached.
+	 *
+	 * The condition checked is the "dirty objects" bitmap state -see popDrtyMpb()-, so an object is considered changed from the moment it's **outputsChange** attribute flag is set until it's retrieved by the popDrtyMpb() method or the flag is reset. If the condition is already met when the method is invoked it returns immediately.
+	 *
+	 * While waiting, in AVR architecture mcus the mcu is set to **idle sleep mode** between interrupts, instead of keeping the loop() running, reducing the power consumption. The mcu is woken up by any interrupt, including the timer interrupt that updates the objects status, and the condition is checked again. In other architectures the waiting is done by executing the yield() function between checks.
+	 *
+	 * @param timeout Maximum time -in milliseconds- to wait. A 0 value waits with no time limit.
+	 * @param sbstArr Pointer to an array of pointers to the objects to wait for. If nullptr is passed all the objects are considered.
+	 * @param sbstQty Number of elements in the sbstArr array.
+	 *
+	 * @retval true: a change was detected.
+	 * @retval false: the timeout was reached with no change detected, or there was no object to wait for -the list is empty, or no object of the subset is in it- and the method returned immediately.
+	 *
+	 * @note Only the objects tracked by the "dirty objects" bitmap are considered, see popDrtyMpb().
+	 * @note Host builds: when the library is compiled for a host over a simulated Arduino API layer with the **_MpbHostBuild** macro defined, the calling thread is blocked on a condition variable notified at the end of every timer interrupt service execution, i.e. every time the simulation advances the clock and invokes the service, and the timeout is measured with the simulated millis() value. The service must be invoked from another thread, so the behavior might be tested with no hardware.
+	 * @warning The method must be invoked from the loop() code only, never from inside an interrupt service or a function executed by an object's state change.
+	 */
+	static bool waitForChange(const unsigned long int &timeout = 0, DbncdMPBttn** sbstArr = nullptr, const uint8_t &sbstQty = 0);
 
 };
 
@@ -596,6 +1043,11 @@ public:
  * @class DbncdDlydMPBttn
  */
 class DbncdDlydMPBttn: public DbncdMPBttn{
+protected:
+	virtual void _cfgPkg(uint8_t* &bufPtr);
+	virtual bool _cfgUnpkg(const uint8_t* &bufPtr);
+	virtual uint8_t _getCfgClsId();
+
 public:
     /**
      * @brief Default constructor
@@ -681,7 +1133,11 @@ protected:
 	volatile bool _validUnlatchPend{false};
 	volatile bool _validUnlatchRlsPend{false};
 
+	virtual void _cfgPkg(uint8_t* &bufPtr);
+	virtual bool _cfgUnpkg(const uint8_t* &bufPtr);
+	virtual uint8_t _getCfgClsId();
 	virtual void mpbPollCallback();
+	virtual void _rstrSttsPkg(const uint32_t &sttsPkg);
 	virtual void stDisabled_In(){};
 	virtual void stDisabled_Out(){};
 	virtual void stLtchNVUP_Do(){};
@@ -721,7 +1177,7 @@ public:
 	/**
 	 * @brief See DbncdMPBttn::clrStatus(bool)
 	 */
-	void clrStatus(bool clrIsOn = true);
+	virtual void clrStatus(bool clrIsOn = true);
    /**
     * @brief Returns the value of the isLatched attribute flag, indicating the **Latched** or **Unlatched** condition of the object.
     *
@@ -757,6 +1213,13 @@ public:
 	 * @return The current value of the "Valid Unlatch Release Pending" attribute.
 	 */
 	const bool getUnlatchRlsPend() const;
+	/**
+	 * @brief Returns if the object's state machine supports being unlatched by the unlatch() method.
+	 *
+	 * @retval true: the object latches, and might be unlatched by the unlatch() method.
+	 * @retval false: the object never latches -i.e. DblActnLtchMPBttn subclasses objects-, the unlatch() method has no effect on it.
+	 */
+	virtual bool getUnltchSpprtd();
 	/**
 	 * @brief Sets the value of the trnOffASAP attribute.
 	 *
@@ -790,8 +1253,10 @@ public:
 	 *
 	 * By setting the values of the validUnlatchPending **and** validUnlatchReleasePending flags it's possible to modify the current MPB status by generating an unlatch signal.
 	 *
-	 * @retval true the object was latched and the unlatch flags were set.
-	 * @retval false the object was not latched, no unlatch flags were set.
+	 * @retval true the object was latched, or On and still to be latched, and the unlatch flags were set.
+	 * @retval false the object was Off, no unlatch flags were set.
+	 *
+	 * @note An object that is On but still not latched -i.e. a TgglLtchMPBttn kept pressed- keeps the unlatch flags pending and is unlatched as soon as it latches, so it turns Off when released.
 	 *
 	 * @note Setting the values of the validUnlatchPending and validUnlatchReleasePending flags does not implicate immediate unlatching the MPB but providing the unlatching signals. The unlatching signals will be processed by the MPB according to it's embedded behavioral pattern. For example, the signals will be processed if the MPB is in Enabled state and latched, but will be ignored if the MPB is disabled.
 	 */
@@ -852,7 +1317,14 @@ protected:
     bool _tmRstbl {true};
     unsigned long int _srvcTime {};
     unsigned long int _srvcTimerStrt{0};
+    mpbTmr_t _srvcTmr{};
 
+    virtual void _armSrvcTmrs();
+    virtual void _cfgPkg(uint8_t* &bufPtr);
+    virtual bool _cfgUnpkg(const uint8_t* &bufPtr);
+    virtual void _dsrmSrvcTmrs();
+    virtual uint8_t _getCfgClsId();
+    virtual void _rstrSttsPkg(const uint32_t &sttsPkg);
     virtual void stOffNotVPP_Out();
     virtual void stOffVPP_Out();
     virtual void updValidUnlatchStatus();
@@ -884,7 +1356,7 @@ public:
 	/**
      * @brief see DbncdMPBttn::clrStatus(bool)
      */
-	void clrStatus(bool clrIsOn = true);
+	virtual void clrStatus(bool clrIsOn = true);
     /**
      * @brief Returns the configured Service Time.
      *
@@ -892,14 +1364,23 @@ public:
      */
 	const unsigned long int getSrvcTime() const;
 	/**
+	 * @brief Returns the time remaining until the Service Time expires and the MPB is unlatched.
+	 *
+	 * The value is calculated from the service timer deadline, no matter how long the Service Time setting is.
+	 *
+	 * @return The time remaining in milliseconds. 0 if the service timer is not running (the MPB is not latched) or it already expired.
+	 */
+	const unsigned long int getSrvcTmRmnng() const;
+	/**
      * @brief Sets a new value to the Service Time attribute
      *
      * @param newSrvcTime New value for the Service Time attribute
      *
      * @note To ensure a safe and predictable behavior from the instantiated objects a minimum Service Time setting guard is provided, ensuring data and signals processing are completed before unlatching process is enforced by the timer. The guard is set by the defined _MinSrvcTime constant.
+     * @note The maximum Service Time setting is set by the defined _MaxSrvcTime constant (0x7FFFFFFF ms, about 24.8 days): the timers deadlines are compared as signed time differences, so longer settings would make the timer expire as soon as it's armed.
      *
-     * @retval true if the newSrvcTime parameter is equal to or greater than the minimum setting guard, the new value is set.
-     * @retval false The newSrvcTime parameter is less than the minimum setting guard, the srvcTime attribute was not changed.
+     * @retval true if the newSrvcTime parameter is in the _MinSrvcTime to _MaxSrvcTime range, the new value is set.
+     * @retval false The newSrvcTime parameter is out of the valid range, the srvcTime attribute was not changed.
 	  * 
 	  * @attention The "service time completed", as every other timing related behavior of the MPBttn objects, is computed and updated by the attached timer, and the checking period is the one set by the begin(unsigned long int) method. There must be some correlation between both values. If the timer is set to a very high value, the "service time" will not be checked so frequently, so the service time will be completed, but the MPBttn status will not be updated untill next timer update calling. That's also the reason why each MPBttn object might be configured with different update periods of time: to check more frequently on those objects with short service times, less frequently on those objects that don't require to be checked so frequently, and avoid the time loss by checking every MPBttn at it's optimal pace.
      */
@@ -946,12 +1427,26 @@ protected:
 	volatile bool _pilotOn{false};
 	unsigned long int _wrnngMs{0};
 	volatile bool _wrnngOn {false};
+	volatile uint8_t _wrnngStg{0};
+	uint8_t _wrnngStgRchd{0};
+	unsigned long int _wrnngStgsDdln[_WrnngStgsMax]{};
+	void (*_fnWhnTrnOffWrnngStg[_WrnngStgsMax])() {};
+	void (*_fnWhnTrnOnWrnngStg[_WrnngStgsMax])() {};
+	uint8_t _wrnngStgsPrctg[_WrnngStgsMax]{};
+	uint8_t _wrnngStgsQty{0};
+	mpbTmr_t _wrnngStgTmr{};
+	mpbTmr_t _wrnngTmr{};
 
 	bool _validWrnngSetPend{false};
 	bool _validWrnngResetPend{false};
 	bool _validPilotSetPend{false};
 	bool _validPilotResetPend{false};
 
+	virtual void _armSrvcTmrs();
+	virtual void _cfgPkg(uint8_t* &bufPtr);
+	virtual bool _cfgUnpkg(const uint8_t* &bufPtr);
+	virtual void _dsrmSrvcTmrs();
+	virtual uint8_t _getCfgClsId();
 	virtual void mpbPollCallback();
 	uint32_t _otptsSttsPkg(uint32_t prevVal = 0);
 	virtual void stDisabled_In();
@@ -959,12 +1454,14 @@ protected:
 	virtual void stOffNotVPP_In();
 	virtual void stOffVPP_Out();
 	virtual void stOnNVRP_Do();
+	void _setWrnngStg(const uint8_t &newStg);
 	void _turnOffPilot();
 	void _turnOffWrnng();
 	void _turnOnPilot();
 	void _turnOnWrnng();
 	bool updPilotOn();
 	bool updWrnngOn();
+	uint8_t updWrnngStg();
 public:
 	/**
 	 * @brief Default constructor
@@ -996,7 +1493,7 @@ public:
    /**
     * @brief see DbncdMPBttn::clrStatus(bool)
     */
-	void clrStatus(bool clrIsOn = true);
+	virtual void clrStatus(bool clrIsOn = true);
 	/**
 	 * @brief Returns the function that is set to execute every time the object's **Pilot** attribute flag **enters** the **Off State**.
 	 *
@@ -1019,6 +1516,15 @@ public:
 	 * @warning The function code execution will become part of the list of procedures the object executes when it enters the **Warning Off State**, including the possibility to modify  attribute flags and others. Making the function code too time demanding must be handled with care, using alternative execution schemes, for example (and not limited to) the function might set flags, modify counters and parameters to set the conditions to execute some code in the main loop, and that suspends itself at the end of its code, to let a new function calling event resume it once again.
 	 */
 	fncPtrType getFnWhnTrnOffWrnng();
+	/**
+	 * @brief Returns the function that is set to execute every time the object **leaves** the indicated **Warning Stage**.
+	 *
+	 * @param stg Warning stage number, in the 1 <= stg <= getWrnngStgsQty() range.
+	 *
+	 * @return A function pointer to the function set to execute every time the object leaves the indicated Warning Stage.
+	 * @retval nullptr if there is no function set, or the stg parameter is out of range.
+	 */
+	fncPtrType getFnWhnTrnOffWrnngStg(const uint8_t &stg);
 	/**
 	 * @brief Returns the function that is set to execute every time the object's **Pilot** attribute flag **enters** the **On State**.
 	 *
@@ -1041,6 +1547,15 @@ public:
 	 * @warning The function code execution will become part of the list of procedures the object executes when it enters the **Warning On State**, including the possibility to modify  attribute flags and others. Making the function code too time demanding must be handled with care, using alternative execution schemes, for example (and not limited to) the function might set flags, modify counters and parameters to set the conditions to execute some code in the main loop, and that suspends itself at the end of its code, to let a new function calling event resume it once again.
 	 */
 	fncPtrType getFnWhnTrnOnWrnng();
+	/**
+	 * @brief Returns the function that is set to execute every time the object **enters** the indicated **Warning Stage**.
+	 *
+	 * @param stg Warning stage number, in the 1 <= stg <= getWrnngStgsQty() range.
+	 *
+	 * @return A function pointer to the function set to execute every time the object enters the indicated Warning Stage.
+	 * @retval nullptr if there is no function set, or the stg parameter is out of range.
+	 */
+	fncPtrType getFnWhnTrnOnWrnngStg(const uint8_t &stg);
 	/**
 	 * @brief Returns a pointer to a function that is set to execute every time the object **enters** the **Pilot Off State**.
 	 * 
@@ -1123,6 +1638,28 @@ public:
 	 * - 100: Will keep the warningOn flag always true (i.e. will turn to true for the 100% of the Service Time).
 	 */
     const bool getWrnngOn() const;
+	/**
+	 * @brief Returns the current Warning Stage.
+	 *
+	 * The warning stages are an extension of the warningOn flag mechanism: several thresholds might be configured through the setWrnngStgs() method, and the object advances through them as the service time expiration approaches. Only one stage is current at a time, entering a stage means leaving the previous one.
+	 *
+	 * @return The current Warning Stage number.
+	 * @retval 0 no stage reached yet, the MPB is not latched or there are no stages configured.
+	 * @retval 1 <= value <= getWrnngStgsQty() the number of the last stage reached.
+	 */
+	const uint8_t getWrnngStg() const;
+	/**
+	 * @brief Returns the number of configured Warning Stages.
+	 *
+	 * @return The number of Warning Stages set by the setWrnngStgs() method, 0 if no stages are configured.
+	 */
+	const uint8_t getWrnngStgsQty() const;
+	/**
+	 * @brief Returns the time remaining until the warningOn attribute flag is set.
+	 *
+	 * @return The time remaining in milliseconds. 0 if the service timer is not running, if the warning is already set, or if the warning percentage is set to 0.
+	 */
+	const unsigned long int getWrnngTmRmnng() const;
 	/**
 	 * @brief Sets the function that will be called to execute every time the object's **Pilot** is **reset**.
 	 *
@@ -1139,6 +1676,18 @@ public:
 	 * @param newFnWhnTrnOff Function pointer to the function intended to be called when the object's **Warning** is **reset**. Passing **nullptr** as parameter deactivates the function execution mechanism.
 	 */
 	void setFnWhnTrnOffWrnngPtr(void(*newFnWhnTrnOff)());
+	/**
+	 * @brief Sets the function that will be called to execute every time the object **leaves** the indicated **Warning Stage**.
+	 *
+	 * The stage is left when the next stage is entered, when the service time is restarted and when the MPB is unlatched or disabled.
+	 *
+	 * @param stg Warning stage number, in the 1 <= stg <= _WrnngStgsMax range. The functions might be set before the stages are configured.
+	 * @param newFnWhnTrnOff Function pointer to the function intended to be called when the object leaves the stage. Passing **nullptr** as parameter deactivates the function execution mechanism.
+	 *
+	 * @retval true the stg parameter was within range, the function was set.
+	 * @retval false the stg parameter was outside range, nothing was changed.
+	 */
+	bool setFnWhnTrnOffWrnngStgPtr(const uint8_t &stg, void(*newFnWhnTrnOff)());
 	/**
 	 * @brief Sets the function that will be called to execute every time the object's **Pilot** is **set**.
 	 *
@@ -1155,6 +1704,16 @@ public:
 	 * @param newFnWhnTrnOn: function pointer to the function intended to be called when the object's **Wrnng** is **set**. Passing **nullptr** as parameter deactivates the function execution mechanism.
 	 */
 	void setFnWhnTrnOnWrnngPtr(void(*newFnWhnTrnOn)());
+	/**
+	 * @brief Sets the function that will be called to execute every time the object **enters** the indicated **Warning Stage**.
+	 *
+	 * @param stg Warning stage number, in the 1 <= stg <= _WrnngStgsMax range. The functions might be set before the stages are configured.
+	 * @param newFnWhnTrnOn Function pointer to the function intended to be called when the object enters the stage. Passing **nullptr** as parameter deactivates the function execution mechanism.
+	 *
+	 * @retval true the stg parameter was within range, the function was set.
+	 * @retval false the stg parameter was outside range, nothing was changed.
+	 */
+	bool setFnWhnTrnOnWrnngStgPtr(const uint8_t &stg, void(*newFnWhnTrnOn)());
 	/**
 	 * @brief Sets a function to be executed every time the object **enters** the **Pilot Off State**.
 	 *
@@ -1247,6 +1806,22 @@ public:
 	 * @retval false the value was outside range, the value change was dismissed.
 	 */
 	bool setWrnngPrctg (const unsigned int &newWrnngPrctg);
+	/**
+	 * @brief Sets the Warning Stages thresholds.
+	 *
+	 * Each stage threshold is expressed as the setWrnngPrctg() value is: the percentage of the service time **before expiration** at which the stage is entered. For stages entered at the 80%, 90% and 95% of the service time the thresholds are {20, 10, 5}.
+	 * The stages deadlines are calculated once when the service time starts, and a single soft-timer is kept armed for the next stage to be reached, so the polling cost is the same whatever the number of stages configured is.
+	 *
+	 * @param prctgArr Array of thresholds, each one in the 0 < value <= 100 range and in strictly decreasing order.
+	 * @param stgsQty Number of thresholds in the array, in the 0 <= stgsQty <= _WrnngStgsMax range. A 0 value removes the stages configuration.
+	 *
+	 * @retval true the parameters were valid, the new stages are set.
+	 * @retval false the parameters were not valid, the configuration was not changed.
+	 *
+	 * @note If the service time is running, the stages are recalculated from it's start, the stages already passed are entered at the next poll.
+	 * @note The stages are independent from the warningOn flag, both mechanisms might be used at the same time.
+	 */
+	bool setWrnngStgs(const uint8_t* prctgArr, const uint8_t &stgsQty);
 };
 
 //==========================================================>>
@@ -1262,9 +1837,19 @@ public:
 class XtrnUnltchMPBttn: public LtchMPBttn{
 protected:
     DbncdDlydMPBttn* _unLtchBttn {nullptr};
+    unsigned long int _unLtchDbncTime {0};
+    unsigned long int _unLtchDbncTmrStrt {0};
+    bool _unLtchIsOn {false};
+    uint8_t _unLtchPin {_InvalidPinNum};
+    bool _unLtchPulledUp {true};
+    bool _unLtchTypeNO {true};
     bool _xtrnUnltchPRlsCcl {false};
 
+	virtual void _cfgPkg(uint8_t* &bufPtr);
+	virtual bool _cfgUnpkg(const uint8_t* &bufPtr);
+	virtual uint8_t _getCfgClsId();
  	virtual void stOffNVURP_Do();
+ 	void _updUnltchInpt();
  	virtual void updValidUnlatchStatus();
 
 public:
@@ -1296,14 +1881,54 @@ public:
      */
     XtrnUnltchMPBttn(const uint8_t &mpbttnPin,  
         const bool &pulledUp,  const bool &typeNO,  const unsigned long int &dbncTimeOrigSett,  const unsigned long int &strtDelay);
+    /**
+     * @brief Class constructor
+     *
+     * This class constructor instantiates an object that reads the unlatch signal from a GPIO pin **inline**, as part of it's own status update, through an embedded lightweight debouncer. No second object is needed nor included in the "list of MPBs to keep updated", so no timing skew between the latched MPB and the unlatch signal is possible.
+     *
+     * @param unLtchPin Pin id number of the unlatch input signal pin. The unlatch input is configured with the same **pulledUp**, **typeNO** and **dbncTimeOrigSett** parameters as the main MPB, to set different values see setUnltchPin(const uint8_t, const bool, const bool, const unsigned long int).
+     *
+     * @note For the other parameters see DbncdDlydMPBttn(const uint8_t, const bool, const bool, const unsigned long int, const unsigned long int)
+     */
+    XtrnUnltchMPBttn(const uint8_t &mpbttnPin, const uint8_t &unLtchPin,
+        const bool &pulledUp,  const bool &typeNO,  const unsigned long int &dbncTimeOrigSett,  const unsigned long int &strtDelay);
     /**
      * @brief See DbncdMPBttn::begin(const unsigned long int)
+     *
+     * @note If an inline unlatch pin is set the pin is configured as input, and the DbncdDlydMPBttn object set as unlatch source -if any- is **not** started.
      */
     virtual bool begin(const unsigned long int &pollDelayMs = _StdPollDelay);
     /**
      * @brief See DbncdMPBttn::clrStatus(bool)
      */
-    void clrStatus(bool clrIsOn = true);
+    virtual void clrStatus(bool clrIsOn = true);
+    /**
+     * @brief Returns the debounced state of the inline unlatch input signal.
+     *
+     * @retval true: the unlatch input signal is active.
+     * @retval false: the unlatch input signal is not active, or no inline unlatch pin is set.
+     */
+    bool getUnltchInptOn();
+    /**
+     * @brief Returns the inline unlatch input pin.
+     *
+     * @return The pin id number of the inline unlatch input signal.
+     * @retval _InvalidPinNum: no inline unlatch pin is set.
+     */
+    uint8_t getUnltchPin();
+    /**
+     * @brief Sets a GPIO pin as the inline unlatch input signal source.
+     *
+     * The unlatch input is read and debounced as part of the object's own status update. When an inline unlatch pin is set it replaces the DbncdDlydMPBttn object set as unlatch source -if any-, which will not be started nor read.
+     *
+     * @param unLtchPin Pin id number of the unlatch input signal pin. Passing _InvalidPinNum restores the use of the DbncdDlydMPBttn object set as unlatch source.
+     * @param pulledUp (Optional) See DbncdMPBttn(const uint8_t, const bool, const bool, const unsigned long int)
+     * @param typeNO (Optional) See DbncdMPBttn(const uint8_t, const bool, const bool, const unsigned long int)
+     * @param dbncTime (Optional) Time in milliseconds the unlatch input must be kept stable for a level change to be accepted, both for activation and deactivation. Values below the minimum debounce time (_HwMinDbncTime) are set to the minimum debounce time.
+     *
+     * @attention The inline unlatch pin must be set before the begin() method is invoked, as the pin is configured as input by that method.
+     */
+    void setUnltchPin(const uint8_t &unLtchPin, const bool &pulledUp = true, const bool &typeNO = true, const unsigned long int &dbncTime = 0);
 };
 
 //==========================================================>>
@@ -1350,6 +1975,7 @@ protected:
    volatile bool _isOnScndry{false};
 	fdaDALmpbStts _mpbFdaState {stOffNotVPP};
 	unsigned long _scndModActvDly {2000};
+	mpbTmr_t _scndModTmr{};
 	unsigned long _scndModTmrStrt {0};
 	bool _validScndModPend{false};
 
@@ -1360,8 +1986,12 @@ protected:
 	void (*_fnWhnTrnOffScndry)() {nullptr};
 	void (*_fnWhnTrnOnScndry)() {nullptr};
 
+	virtual void _cfgPkg(uint8_t* &bufPtr);
+	virtual bool _cfgUnpkg(const uint8_t* &bufPtr);
+	virtual uint8_t _getCfgClsId();
 	virtual void mpbPollCallback();
 	virtual uint32_t _otptsSttsPkg(uint32_t prevVal = 0);
+	virtual void _rstrSttsPkg(const uint32_t &sttsPkg);
 	virtual void stDisabled_In(){};
    virtual void stOnEndScndMod_Out(){};
    virtual void stOnScndMod_Do() = 0;
@@ -1395,7 +2025,7 @@ public:
 	/**
 	 * @brief See DbncddMPBttn::clrStatus(bool)
 	 */
-   void clrStatus(bool clrIsOn = true);
+   virtual void clrStatus(bool clrIsOn = true);
 	/**
 	 * @brief returns the function that is set to execute every time the object **enters** the **Secondary Off State**.
 	 *
@@ -1460,6 +2090,12 @@ public:
 	 * @return The current scndModActvDly value, i.e. the delay in milliseconds.
 	 */
    unsigned long getScndModActvDly();
+	/**
+	 * @brief See LtchMPBttn::getUnltchSpprtd()
+	 *
+	 * @retval false: the double action objects never latch, the main On state is turned Off only by a short press.
+	 */
+	virtual bool getUnltchSpprtd();
 	/**
 	 * @brief Sets the function that will be called to execute every time the object **enters** the **Secondary Off State**.
 	 *
@@ -1513,7 +2149,7 @@ public:
 	/**
 	 * @brief Sets a new value for the scndModActvDly class attribute
 	 *
-	 * The scndModActvDly attribute defines the time length a MPB must remain pressed after the end of the debounce&delay period to consider it a **long press**, needed to activate the **secondary mode**. The value setting must be newVal >= _MinSrvcTime to ensure correct signal processing. See TmLtchMPBttn::setSrvcTime(const unsigned long int) for details.
+	 * The scndModActvDly attribute defines the time length a MPB must remain pressed after the end of the debounce&delay period to consider it a **long press**, needed to activate the **secondary mode**. The value setting must be newVal >= _MinSrvcTime to ensure correct signal processing, and newVal <= _MaxSrvcTime as it's timed by the same timers. See TmLtchMPBttn::setSrvcTime(const unsigned long int) for details.
 	 *
 	 * @param newVal The new value for the scndModActvDly attribute.
 	 *
@@ -1560,7 +2196,7 @@ public:
 	/**
 	 * @brief See DbncddMPBttn::clrStatus(bool)
 	 */
-   void clrStatus(bool clrIsOn = true);
+   virtual void clrStatus(bool clrIsOn = true);
 };
 
 //==========================================================>>
@@ -1591,10 +2227,32 @@ protected:
 	uint16_t _otptCurVal{};
 	bool _otptCurValIsMax{false};
 	bool _otptCurValIsMin{false};
+	uint8_t _otptMp{OtptMpLnr};
+	const uint16_t* _otptMpTblPtr{nullptr};	// Output mapping table, stored in flash memory (PROGMEM)
+	uint8_t _otptMpTblSz{0};
+	uint16_t _otptMppdVal{0};
+	volatile uint16_t* _otptPwmOcrPtr{nullptr};
+	uint16_t _otptPwmOcrTop{0};
+	uint8_t _otptPwmPin{_InvalidPinNum};
+	uint8_t _otptPwmRes{8};
 	unsigned long _otptSldrSpd{1};
 	uint16_t _otptSldrStpSize{0x01};
 	uint16_t _otptValMax{0xFFFF};
 	uint16_t _otptValMin{0x0000};
+	uint8_t _sldrAccl{SldrAcclNone};
+	uint8_t _sldrAcclMax{1};
+	const uint16_t* _sldrAcclTblPtr{nullptr};
+	uint8_t _sldrAcclTblIdx{0};
+	uint8_t _sldrAcclTblSz{0};
+	unsigned long _sldrAcclTm{0};
+	uint32_t _sldrBsRt{0x10000};	// Base slider rate in steps/millisecond, Q16.16 fixed point format
+	uint32_t _sldrRt{0x10000};	// Current slider rate in steps/millisecond, Q16.16 fixed point format
+	uint32_t _sldrRtMax{0x10000};
+	uint32_t _sldrRtSgmntBs{0x10000};
+	unsigned long _sldrRtSgmntStrt{0};
+	uint32_t _sldrRtSlp{0};	// Slider rate increment for each millisecond of the current segment, Q16.16 fixed point format
+	uint32_t _sldrRtSlpBs{0};
+	uint32_t _sldrStpsAcc{0};	// Steps accumulator, keeps the fractional steps between updates, Q16.16 fixed point format
 
 	fncVdPtrPrmPtrType _fnVdPtrPrmWhnTrnOffSldrMax{nullptr};	// _fVPPWhnTrnOffSldrMax
 	void* _fnVdPtrPrmWhnTrnOffSldrMaxArgPtr{nullptr};	// _fVPPWhnTrnOffSldrMaxArgPtr
@@ -1617,8 +2275,13 @@ protected:
 	void (*_fnWhnTrnOffSldrDirUp)() {nullptr};
 	void (*_fnWhnTrnOnSldrDirUp)() {nullptr};
 
+	virtual void _cfgPkg(uint8_t* &bufPtr);
+	virtual bool _cfgUnpkg(const uint8_t* &bufPtr);
+	virtual uint8_t _getCfgClsId();
 	void _ntfyChngSldrDir();
 	virtual uint32_t _otptsSttsPkg(uint32_t prevVal = 0);
+	void _rstSldrRt();
+	virtual void _rstrSttsPkg(const uint32_t &sttsPkg);
 	bool _setSldrDir(const bool &newVal);
 	void stOnEndScndMod_Out();
    virtual void stOnScndMod_Do();
@@ -1627,6 +2290,10 @@ protected:
 	void _turnOnSldrMax();
 	void _turnOffSldrMin();
 	void _turnOnSldrMin();
+	void _updOtptMppdVal();
+	void _updSldrRt(const unsigned long &curTm);
+	void _updSldrRtPrms();
+	void _wrtOtptPwm();
 
 public:
 	/**
@@ -1649,7 +2316,7 @@ public:
 	 *
 	 * @note See DbncdMPBttn::clrStatus(bool)
 	 */
-   void clrStatus(bool clrIsOn = true);
+   virtual void clrStatus(bool clrIsOn = true);
 	/**
 	 * @brief Returns the function set to be called when the slider direction is set to be decrementing (down).
 	 * 
@@ -1841,6 +2508,30 @@ public:
     * @retval false: The **Output Current Value** is **not** equal to the **Minimum value setting**.
     */
    bool getOtptCurValIsMin();
+	/**
+	 * @brief Returns the output mapping table setting
+	 *
+	 * @return The output mapping table code: OtptMpLnr, OtptMpGmm22, OtptMpLog or OtptMpCstm.
+	 */
+	uint8_t getOtptMp();
+	/**
+	 * @brief Returns the **output mapped value**
+	 *
+	 * The output mapped value is the otptCurVal register position in the [otptValMin, otptValMax] range, mapped through the selected output mapping table to the full uint16_t range (0x0000 for the otptValMin, 0xFFFF for the otptValMax when the table ends at 0xFFFF). The values between the table entries are linearly interpolated.
+	 * The mapped value is calculated only when the otptCurVal register, the output values range or the mapping table change, so the method just returns the last calculated value. This makes it suitable to directly feed a PWM dimmer with a perceptually corrected value without the cost of a gamma calculation on each reading.
+	 *
+	 * @return The output mapped value.
+	 *
+	 * @note See setOtptMp(const uint8_t) and setOtptMpTbl(const uint16_t*, const uint8_t) for the mapping tables description.
+	 */
+	uint16_t getOtptMppdVal();
+	/**
+	 * @brief Returns the pin bound to the output mapped value by the setOtptPwmPin(const uint8_t, const uint8_t) method
+	 *
+	 * @return The PWM pin number.
+	 * @retval _InvalidPinNum No pin is bound.
+	 */
+	uint8_t getOtptPwmPin();
 	/**
 	 * @brief Returns the current setting for the **Output Slider Speed** value.
 	 *
@@ -1873,6 +2564,14 @@ public:
 	 * @return The minimum **output current value** set.
 	 */
 	uint16_t getOtptValMin();
+	/**
+	 * @brief Returns the slider acceleration curve setting
+	 *
+	 * @return The acceleration curve code: SldrAcclNone, SldrAcclLnr, SldrAcclExp or SldrAcclTbl.
+	 *
+	 * @note See setSldrAccl(const uint8_t, const unsigned long, const uint8_t) and setSldrAcclTbl(const uint16_t*, const uint8_t, const unsigned long) for the curves description.
+	 */
+	uint8_t getSldrAccl();
 	/**
 	 * @brief Returns the value of the curSldrDirUp attribute
 	 *
@@ -2024,31 +2723,89 @@ public:
 	 */
 	bool setOtptCurVal(const uint16_t &newVal);
 	/**
-	 * @brief Sets the output slider speed (**otptSldrSpd**) attribute.
+	 * @brief Sets the output mapping table to one of the embedded tables
 	 *
-	 * As described in the SldrDALtchMPBttn class definition, the **otptSldrSpd** value is the factor by which the time between two readings of the MPB pressing state in secondary mode is converted into "slider steps". At instantiation the value is set to 1, meaning 1 millisecond is equivalent to 1 step, the "**slowest**" speed configuration. Rising the value will make each millisecond represent more steps, making the change of current value faster.
+	 * The embedded tables are stored in flash memory (PROGMEM), and hold 33 entries equally spaced in the [otptValMin, otptValMax] range:
+	 * - **OtptMpLnr**: Linear mapping, the output mapped value is the otptCurVal register position in it's range scaled to the full uint16_t range. This is the setting at instantiation.
+	 * - **OtptMpGmm22**: Gamma 2.2 correction curve, the usual setting for LEDs dimmers.
+	 * - **OtptMpLog**: Logarithmic (perceptual) curve, the output is (1000^x - 1)/999 for a range position x in [0, 1], for a 60 dB dimming range.
 	 *
-	 * @param newVal The new value for the **otptSldrSpd** attribute.
+	 * @param newMp The output mapping table code: OtptMpLnr, OtptMpGmm22 or OtptMpLog. To set a custom table use setOtptMpTbl(const uint16_t*, const uint8_t).
 	 *
-	 * @return The success in the value of the attribute
-	 * @retval true The parameter was a valid value, the attribute is set to the new value.
-	 * @retval false The parameter is an invalid value, the attribute is not changed.
+	 * @return The success in setting the mapping table.
+	 * @retval true The code was valid, the mapping table is set and the output mapped value recalculated.
+	 * @retval false The code was not valid, the setting is not changed.
+	 */
+	bool setOtptMp(const uint8_t &newMp);
+	/**
+	 * @brief Sets a custom output mapping table (**OtptMpCstm**)
 	 *
-	 * @note Making the **otptSldrSpd** equal to 0 would void the ability to change the slider value, so the range of acceptable values is 1<= newVal <= (2^16-1).
-	 * @warning A "wrong" combination of **otptSldrSpd** and **otptSldrStpSize** might result in value change between readings greater than the range set by the **otptValMin** and the **otptValMax** values. The relation between the four parameters must be kept in mind if the application developed gives the final user the capability to configure those values at runtime.
+	 * @param tblPtr Pointer to an array of uint16_t output values **stored in flash memory** (declared with the PROGMEM attribute), the first element corresponds to the otptValMin value and the last one to the otptValMax value, the rest are equally spaced in between. The array is not copied, so it must remain valid while it's set.
+	 * @param tblSz Number of elements of the array, valid range is 2 <= tblSz <= 255.
+	 *
+	 * @return The success in setting the mapping table.
+	 * @retval true The parameters were valid, the mapping table is set and the output mapped value recalculated.
+	 * @retval false The tblPtr was a nullptr or the tblSz was out of range, the setting is not changed.
 	 */
-	bool setOtptSldrSpd(const uint16_t &newVal);
+	bool setOtptMpTbl(const uint16_t* tblPtr, const uint8_t &tblSz);
 	/**
-	 * @brief Sets the output slider step size (**otptSldrStpSize**) attribute value.
+	 * @brief Binds the output mapped value to a timer compare register
 	 *
-	 * @param newVal The new value for the outputSliderStepSize attribute.
+	 * Each time the output mapped value changes -see getOtptMppdVal()- the value is scaled to the [0, ocrTop] range and written to the compare register, from the same timer callback that updates the otptCurVal register. The application main loop is not involved, so the PWM output follows the slider with no added latency.
+	 * The timer must be configured by the application in a PWM mode with ocrTop as the TOP value (i.e. an ICRn register) before the binding. Binding a compare register releases a pin bound by setOtptPwmPin(const uint8_t, const uint8_t).
 	 *
-	 * @note The new value for the step size must be smaller or equal than the size of the valid range of otptCurVal attribute
+	 * @param ocrPtr Pointer to the 16 bits compare register (i.e. &OCR3A), a nullptr releases the binding.
+	 * @param ocrTop The TOP value of the timer, the output mapped value 0xFFFF is written as ocrTop.
 	 *
-	 * @retval true If newVal <= (otptValMax - otptValMin), the value of the outputSliderStepSize attribute is changed.
-	 * @retval false Otherwise, and the value of the outputSliderStepSize attribute is not changed.
+	 * @return The success in binding the register.
+	 * @retval true The register was bound -or released if ocrPtr was a nullptr-, the current output mapped value is written to it.
+	 * @retval false The ocrTop was 0, the binding is not changed.
 	 *
-	 * @note For the secondary function to work like a slider, the condition (newVal < ((_otptValMax - _otptValMin) / _otptSldrSpd)) must be kept
+	 * @warning The Timer1 compare registers must not be bound, as the Timer1 is used by the library to generate the timer callback.
+	 */
+	bool setOtptPwmOcr(volatile uint16_t* ocrPtr, const uint16_t &ocrTop);
+	/**
+	 * @brief Binds the output mapped value to a PWM capable pin
+	 *
+	 * Each time the output mapped value changes -see getOtptMppdVal()- the value is scaled to the pwmRes bits resolution and written to the pin with analogWrite(), from the same timer callback that updates the otptCurVal register. The application main loop is not involved, so the PWM output follows the slider with no added latency.
+	 * Binding a pin releases a compare register bound by setOtptPwmOcr(volatile uint16_t*, const uint16_t).
+	 *
+	 * @param pwmPin The PWM capable pin, _InvalidPinNum releases the binding.
+	 * @param pwmRes (Optional) The resolution in bits of the analogWrite() function of the platform, valid range is 1 <= pwmRes <= 16. The AVR cores resolution is fixed to 8 bits, so it's the only value accepted in that architecture, other platforms might configure it with the analogWriteResolution() function.
+	 *
+	 * @return The success in binding the pin.
+	 * @retval true The pin was bound -or released if pwmPin was _InvalidPinNum-, the current output mapped value is written to it.
+	 * @retval false The pwmRes was out of range -or was not 8 in AVR platforms-, or the pin is not PWM capable or it's PWM is generated by the Timer1 (AVR platforms only), the binding is not changed.
+	 *
+	 * @note The pin is written while the MPB is in any state, to keep the output off while the MPB is off the application must use the MPB isOn state to gate the output, or set the otptCurVal to the otptValMin.
+	 */
+	bool setOtptPwmPin(const uint8_t &pwmPin, const uint8_t &pwmRes = 8);
+	/**
+	 * @brief Sets the output slider speed (**otptSldrSpd**) attribute.
+	 *
+	 * As described in the SldrDALtchMPBttn class definition, the **otptSldrSpd** value is the factor by which the time between two readings of the MPB pressing state in secondary mode is converted into "slider steps". At instantiation the value is set to 1, meaning 1 millisecond is equivalent to 1 step, the "**slowest**" speed configuration. Rising the value will make each millisecond represent more steps, making the change of current value faster.
+	 *
+	 * @param newVal The new value for the **otptSldrSpd** attribute.
+	 *
+	 * @return The success in the value of the attribute
+	 * @retval true The parameter was a valid value, the attribute is set to the new value.
+	 * @retval false The parameter is an invalid value, the attribute is not changed.
+	 *
+	 * @note Making the **otptSldrSpd** equal to 0 would void the ability to change the slider value, so the range of acceptable values is 1<= newVal <= (2^16-1).
+	 * @warning A "wrong" combination of **otptSldrSpd** and **otptSldrStpSize** might result in value change between readings greater than the range set by the **otptValMin** and the **otptValMax** values. The relation between the four parameters must be kept in mind if the application developed gives the final user the capability to configure those values at runtime.
+	 */
+	bool setOtptSldrSpd(const uint16_t &newVal);
+	/**
+	 * @brief Sets the output slider step size (**otptSldrStpSize**) attribute value.
+	 *
+	 * @param newVal The new value for the outputSliderStepSize attribute.
+	 *
+	 * @note The new value for the step size must be smaller or equal than the size of the valid range of otptCurVal attribute
+	 *
+	 * @retval true If newVal <= (otptValMax - otptValMin), the value of the outputSliderStepSize attribute is changed.
+	 * @retval false Otherwise, and the value of the outputSliderStepSize attribute is not changed.
+	 *
+	 * @note For the secondary function to work like a slider, the condition (newVal < ((_otptValMax - _otptValMin) / _otptSldrSpd)) must be kept
 	 * @note For the secondary function to work like a slider or a toggle switch, the condition (newVal <= ((_otptValMax - _otptValMin) / _otptSldrSpd)) must be kept
 	 * @note For the secondary function to work like a toggle switch, the condition (newVal = ((_otptValMax - _otptValMin) / _otptSldrSpd)) must be kept.
 	 *
@@ -2087,6 +2844,41 @@ public:
 	 * @warning If the otptValMin attribute intended change is to a greater value, the otptCurVal might be left outside the new valid range (newVal > otptCurVal). In this case the otptCurVal will be changed to be equal to newVal, and so otptCurVal will become equal to otptValMin.
 	 */
 	bool setOtptValMin(const uint16_t &newVal);
+	/**
+	 * @brief Sets the slider acceleration curve
+	 *
+	 * The slider rate -steps per millisecond, as set by the setOtptSldrSpd(const uint16_t) method- is the **base rate** every time the MPB enters the secondary mode, the acceleration curve sets how the rate grows while the MPB is kept pressed in the secondary mode:
+	 * - **SldrAcclNone**: the rate is kept constant at the base rate.
+	 * - **SldrAcclLnr**: the rate grows linearly from the base rate to acclMax times the base rate in acclTm milliseconds, then it's kept constant.
+	 * - **SldrAcclExp**: the rate doubles every acclTm milliseconds -growing linearly inside each acclTm period- until it reaches acclMax times the base rate, then it's kept constant.
+	 *
+	 * The slider keeps the steps count in a fixed point accumulator, so the fractional steps are never lost between the timer callback invocations, and the rates are precalculated by this method, so the timer callback takes no divisions to update the otptCurVal register.
+	 *
+	 * @param crv The acceleration curve code: SldrAcclNone, SldrAcclLnr or SldrAcclExp. To set a SldrAcclTbl curve use setSldrAcclTbl(const uint16_t*, const uint8_t, const unsigned long).
+	 * @param acclTm (Optional) Time in milliseconds of the linear ramp or of each doubling period of the exponential curve. Ignored for SldrAcclNone.
+	 * @param acclMax (Optional) Maximum multiplier of the base rate, valid range is 2 <= acclMax <= 255. Ignored for SldrAcclNone.
+	 *
+	 * @return The success in setting the acceleration curve.
+	 * @retval true The parameters were valid, the curve is set.
+	 * @retval false The curve code was not valid, or the acclTm or acclMax values were out of range, the curve is not changed.
+	 *
+	 * @note The new curve takes effect the next time the MPB enters the secondary mode.
+	 */
+	bool setSldrAccl(const uint8_t &crv, const unsigned long &acclTm = 0, const uint8_t &acclMax = 1);
+	/**
+	 * @brief Sets a table defined slider acceleration curve (**SldrAcclTbl**)
+	 *
+	 * The table holds the base rate multipliers to apply while the MPB is kept pressed in the secondary mode, each one of them is applied for stpTm milliseconds, and the last one is kept until the MPB is released.
+	 *
+	 * @param tblPtr Pointer to an array of uint16_t multipliers in Q8.8 fixed point format (0x0100 == x1, 0x0180 == x1.5, 0x0400 == x4). The array is not copied, so it must remain valid while it's set.
+	 * @param tblSz Number of elements of the array, valid range is 1 <= tblSz <= 255.
+	 * @param stpTm Time in milliseconds each multiplier is applied before moving to the next one.
+	 *
+	 * @return The success in setting the acceleration curve.
+	 * @retval true The parameters were valid, the curve is set.
+	 * @retval false The tblPtr was a nullptr, or the tblSz or stpTm were 0, the curve is not changed.
+	 */
+	bool setSldrAcclTbl(const uint16_t* tblPtr, const uint8_t &tblSz, const unsigned long &stpTm);
 	/**
 	 * @brief Sets the value of the curSldrDirUp attribute to false.
 	 *
@@ -2199,8 +2991,12 @@ protected:
 	bool _validVoidPend{false};
 	bool _validUnvoidPend{false};
 
+	virtual void _cfgPkg(uint8_t* &bufPtr);
+	virtual bool _cfgUnpkg(const uint8_t* &bufPtr);
+	virtual uint8_t _getCfgClsId();
 	virtual void mpbPollCallback();
 	uint32_t _otptsSttsPkg(uint32_t prevVal = 0);
+	virtual void _rstrSttsPkg(const uint32_t &sttsPkg);
 	bool setVoided(const bool &newVoidValue);
 	virtual void stDisabled_In();
 	virtual void stDisabled_Out();
@@ -2232,7 +3028,7 @@ public:
     /**
      * @brief See DbncdMPBttn::clrStatus(bool)
      */
-	void clrStatus(bool clrIsOn = true);
+	virtual void clrStatus(bool clrIsOn = true);
     /**
  	 * @brief Returns the function that is set to execute every time the object **exits** the **Voided State**.
  	 *
@@ -2395,8 +3191,12 @@ public:
 class TmVdblMPBttn: public VdblMPBttn{
 protected:
 	unsigned long int _voidTime;
+	mpbTmr_t _voidTmr{};
 	unsigned long int _voidTmrStrt{0};
 
+	virtual void _cfgPkg(uint8_t* &bufPtr);
+	virtual bool _cfgUnpkg(const uint8_t* &bufPtr);
+	virtual uint8_t _getCfgClsId();
 	virtual void stOffNotVPP_In();
 	virtual void stOffVddNVUP_Do();	//This provides a setting point for calculating the _validUnvoidPend
 	virtual void stOffVPP_Do();	// This provides a setting point for the voiding mechanism to be started
@@ -2411,7 +3211,7 @@ public:
     /**
      * @brief Class constructor
      *
-     * @param voidTime The time -in milliseconds- the MPB must be pressed to enter the **voided state**.
+     * @param voidTime The time -in milliseconds- the MPB must be pressed to enter the **voided state**. Values greater than _MaxSrvcTime are limited to it, see setVoidTime(const unsigned long int).
      *
      * @note For the rest of the parameters see VdblMPBttn(const uint8_t, const bool, const bool, const unsigned long int, const unsigned long int, const bool)
      */
@@ -2427,7 +3227,7 @@ public:
     /**
      * @brief See DbncdMPBttn::clrStatus(bool)
      */
-	void clrStatus();
+	virtual void clrStatus(bool clrIsOn = true);
     /**
      * @brief Returns the voidTime attribute current value.
      *
@@ -2436,14 +3236,22 @@ public:
      * @return The current value of the voidTime attribute.
      */
 	const unsigned long int getVoidTime() const;
+	/**
+	 * @brief Returns the time remaining until the MPB enters the **voided state**.
+	 *
+	 * @return The time remaining in milliseconds. 0 if the MPB is not being pressed (the void timer is not running) or the void time already expired.
+	 */
+	const unsigned long int getVoidTmRmnng() const;
     /**
      * @brief Sets a new value to the Void Time attribute
      *
      * @param newVoidTime New value for the Void Time attribute
      *
+     * @note If the MPB is being pressed the new setting applies to the running voiding time count, measured from the moment the MPB was pressed, as it does for TmLtchMPBttn::setSrvcTime(const unsigned long int).
      * @note To ensure a safe and predictable behavior from the instantiated objects a minimum Void Time (equal to the minimum Service Time) setting guard is provided, ensuring data and signals processing are completed before voiding process is enforced by the timer. The guard is set by the defined _MinSrvcTime constant.
+     * @note The maximum Void Time setting is the maximum Service Time, set by the defined _MaxSrvcTime constant, see TmLtchMPBttn::setSrvcTime(const unsigned long int).
      *
-     * @retval: true if the newVoidTime parameter is equal to or greater than the minimum setting guard. The attribute value is changed.
+     * @retval: true if the newVoidTime parameter is in the _MinSrvcTime to _MaxSrvcTime range. The attribute value is changed.
      * @retval: false otherwise. The attribute value is not changed.
      */
 	bool setVoidTime(const unsigned long int &newVoidTime);
@@ -2495,4 +3303,1183 @@ public:
 
 //==========================================================>>
 
+/**
+ * @brief Models a Gestures recognizer DD-MPB (**GDD-MPB**).
+ *
+ * The **Gestures recognizer Momentary Push Button** keeps the **On state** as a DD-MPB does, while the MPB is pressed, and recognizes the **gestures** the user makes with it, generating a gesture event for each one recognized:
+ * - **Clicks** (GstrClck): a sequence of N short presses (single, double, triple click...), each one released before the long press time, each next press started inside the click window time after the previous release. The event is generated when the click window time expires with no new press, or immediately when the maximum number of clicks is reached. The gesture count holds the number of clicks.
+ * - **Long press** (GstrLngPrss): a press kept for the long press time. The event is generated when the time is reached, without waiting for the release. A long press ends any clicks sequence in progress.
+ * - **Hold repeat** (GstrHldRpt): if the hold repeat is configured, the long press kept pressed generates typematic repeat events, the first one after the hold repeat delay, the next ones separated by the hold repeat period, that is accelerated by a percentage on each repeat until the minimum hold repeat period is reached. The gesture count holds the number of the repeat.
+ *
+ * The gesture events are notified by setting the **outputsChange** flag, making the gesture code and count readable by the getGstr() and getGstrCnt() methods, and by the execution of the function set by the setFVPPWhnGstr(fncVdPtrPrmPtrType, void*) method. The gesture code and count are also included in the **otptCurVal** field of the packaged status -see DbncdMPBttn::getOtptsSttsPkgd()-, the code in the high byte and the count in the low byte.
+ *
+ * All the gestures timing is deadline driven: a single deadline is armed when a gesture needs a time to be checked, and while no deadline is armed an idle object adds no processing to the timer interrupt service besides the inherited state update.
+ *
+ * @class GstrMPBttn
+ */
+class GstrMPBttn: public DbncdDlydMPBttn{
+protected:
+	uint8_t _clcksCnt{0};
+	uint8_t _clcksMax{3};
+	unsigned long int _clckWndw{250};
+	fncVdPtrPrmPtrType _fnVdPtrPrmWhnGstr{nullptr};
+	void* _fnVdPtrPrmWhnGstrArgPtr{nullptr};
+	volatile uint8_t _gstr{GstrNone};
+	volatile uint8_t _gstrCnt{0};
+	bool _gstrDdlnArmd{false};
+	unsigned long int _gstrDdln{0};
+	uint8_t _hldRptAcclPrcnt{0};
+	uint8_t _hldRptCnt{0};
+	unsigned long int _hldRptCurPrd{0};
+	unsigned long int _hldRptDly{0};
+	unsigned long int _hldRptPrd{0};
+	unsigned long int _hldRptPrdMin{0};
+	bool _lngPrssd{false};
+	unsigned long int _lngPrssTm{800};
+
+	void _armGstrDdln(const unsigned long int &curTm, const unsigned long int &dlyTm);
+	virtual void _cfgPkg(uint8_t* &bufPtr);
+	virtual bool _cfgUnpkg(const uint8_t* &bufPtr);
+	virtual uint8_t _getCfgClsId();
+	void _gnrtGstr(const uint8_t &gstr, const uint8_t &gstrCnt);
+	virtual void mpbPollCallback();
+	virtual uint32_t _otptsSttsPkg(uint32_t prevVal = 0);
+	void _updGstr(const bool &prvIsOn);
+
+public:
+	/**
+	 * @brief Default constructor
+	 */
+	GstrMPBttn();
+	/**
+	 * @brief Class constructor
+	 *
+	 * @note For the parameters see DbncdDlydMPBttn(const uint8_t, const bool, const bool, const unsigned long int, const unsigned long int)
+	 */
+	GstrMPBttn(const uint8_t &mpbttnPin, const bool &pulledUp = true, const bool &typeNO = true, const unsigned long int &dbncTimeOrigSett = 0, const unsigned long int &strtDelay = 0);
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~GstrMPBttn();
+	/**
+	 * @brief Clears the last gesture recognized code and count.
+	 */
+	void clrGstr();
+	/**
+	 * @brief See DbncdMPBttn::clrStatus(bool)
+	 *
+	 * Besides the inherited attributes, the gestures in progress are discarded and the last gesture code is cleared.
+	 */
+	virtual void clrStatus(bool clrIsOn = true);
+	/**
+	 * @brief Returns the maximum number of clicks of a clicks sequence.
+	 *
+	 * @return The maximum number of clicks.
+	 */
+	uint8_t getClcksMax();
+	/**
+	 * @brief Returns the click window time.
+	 *
+	 * @return The maximum time -in milliseconds- between a click release and the next click press for both to be part of the same clicks sequence.
+	 */
+	unsigned long int getClckWndw();
+	/**
+	 * @brief Returns the code of the last gesture recognized.
+	 *
+	 * @return The gesture code: GstrClck, GstrLngPrss or GstrHldRpt.
+	 * @retval GstrNone: no gesture was recognized since the last clrGstr() or clrStatus(bool) invocation.
+	 */
+	uint8_t getGstr();
+	/**
+	 * @brief Returns the count of the last gesture recognized.
+	 *
+	 * @return The number of clicks for a GstrClck gesture, the number of the repeat for a GstrHldRpt gesture, 1 for a GstrLngPrss gesture.
+	 */
+	uint8_t getGstrCnt();
+	/**
+	 * @brief Returns the long press time.
+	 *
+	 * @return The time -in milliseconds- the MPB must be kept pressed to generate a long press gesture.
+	 */
+	unsigned long int getLngPrssTm();
+	/**
+	 * @brief Sets the maximum number of clicks of a clicks sequence.
+	 *
+	 * When the clicks sequence reaches this number of clicks the gesture is generated without waiting for the click window time to expire, so setting this value to 1 makes every click to be notified with no delay.
+	 *
+	 * @param newClcksMax The new maximum number of clicks, at least 1.
+	 *
+	 * @retval true: the value was valid and the attribute was changed.
+	 * @retval false: the value was 0, the attribute was not changed.
+	 */
+	bool setClcksMax(const uint8_t &newClcksMax);
+	/**
+	 * @brief Sets the click window time.
+	 *
+	 * @param newClckWndw The new maximum time -in milliseconds- between a click release and the next click press for both to be part of the same clicks sequence.
+	 *
+	 * @retval true: the value was valid and the attribute was changed.
+	 * @retval false: the value was 0, the attribute was not changed.
+	 */
+	bool setClckWndw(const unsigned long int &newClckWndw);
+	/**
+	 * @brief Sets the function to be executed when a gesture is recognized.
+	 *
+	 * The function is executed after the gesture code and count are set, so they might be read from inside the function by the getGstr() and getGstrCnt() methods.
+	 *
+	 * @param newFVPPWhnGstr Pointer to the function to be executed, or **nullptr** to execute no function.
+	 * @param argPtr Pointer to the argument to be passed to the function.
+	 *
+	 * @attention The function is executed from inside the timer interrupt service.
+	 */
+	void setFVPPWhnGstr(fncVdPtrPrmPtrType newFVPPWhnGstr, void* argPtr = nullptr);
+	/**
+	 * @brief Sets the hold repeat parameters.
+	 *
+	 * @param newHldRptDly Time -in milliseconds- from the long press gesture to the first repeat gesture. A 0 value disables the hold repeat.
+	 * @param newHldRptPrd Initial time -in milliseconds- between repeat gestures.
+	 * @param newHldRptPrdMin Minimum time -in milliseconds- between repeat gestures, the acceleration stops when reached. A 0 value, or values greater than newHldRptPrd, are set to newHldRptPrd, disabling the acceleration.
+	 * @param newHldRptAcclPrcnt Percentage the time between repeat gestures is reduced on every repeat, 0 for no acceleration, up to 99.
+	 *
+	 * @retval true: the values were valid and the attributes were changed.
+	 * @retval false: the hold repeat was enabled with a 0 newHldRptPrd value, or the newHldRptAcclPrcnt was greater than 99, the attributes were not changed.
+	 */
+	bool setHldRpt(const unsigned long int &newHldRptDly, const unsigned long int &newHldRptPrd = 0, const unsigned long int &newHldRptPrdMin = 0, const uint8_t &newHldRptAcclPrcnt = 0);
+	/**
+	 * @brief Sets the long press time.
+	 *
+	 * @param newLngPrssTm The new time -in milliseconds- the MPB must be kept pressed to generate a long press gesture.
+	 *
+	 * @note To ensure a safe and predictable behavior from the instantiated objects a minimum time setting guard is provided. The guard is set by the defined _MinSrvcTime constant.
+	 *
+	 * @retval true: the value was equal to or greater than the guard, the attribute was changed.
+	 * @retval false: the value was smaller than the guard, the attribute was not changed.
+	 */
+	bool setLngPrssTm(const unsigned long int &newLngPrssTm);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Abstract class, base for the input signal providers for DbncdMPBttn class and subclasses objects.
+ *
+ * An input provider replaces the GPIO pin reading of the objects set to use it -see DbncdMPBttn::setInptPrvdr(MpbInptPrvdr*)-, returning the level of the input signal identified by the object's **mpbttnPin** attribute value, used as an input index. The providers are intended to model input signals that are not directly connected to a GPIO pin, as the ones read through I/O expanders, shift registers chains, keypad matrixes, other mcus, etc.
+ *
+ * Providers that need to access an expensive resource (a communications bus, a long chain of shift registers) should read all the input signals at once in the updSnpsht() method, keeping a "snapshot" of the input levels, and return the saved values in the getInptLvl(const uint8_t) method. The providers registered to be updated by the setSnpshtUpd(const bool) method will have their updSnpsht() method executed **once** every timer interrupt service, **before** any DbncdMPBttn object status is updated, so the resource is accessed once per timer interrupt and not once per object.
+ *
+ * @warning The updSnpsht() and getInptLvl(const uint8_t) methods will be executed as part of the timer interrupt service, they must be kept short and must not rely on resources that need interrupts to be enabled.
+ *
+ * @class MpbInptPrvdr
+ */
+class MpbInptPrvdr{
+	friend class DbncdMPBttn;
+
+	static MpbInptPrvdr* _snpshtUpdLstPtr;
+	static void _updSnpshts();
+
+	MpbInptPrvdr* _nxtSnpshtUpd{nullptr};
+	bool _snpshtUpd{false};
+
+public:
+	/**
+	 * @brief Default constructor
+	 */
+	MpbInptPrvdr();
+	/**
+	 * @brief Class virtual destructor
+	 *
+	 * Removes the object from the list of providers to be updated every timer interrupt service, if it was included.
+	 */
+	virtual ~MpbInptPrvdr();
+	/**
+	 * @brief Returns the level of the input signal identified by the parameter.
+	 *
+	 * @param inptId Index of the input signal in the provider, as set in the **mpbttnPin** attribute of the DbncdMPBttn object using the provider.
+	 *
+	 * @return The input signal level, to be processed as a GPIO pin level.
+	 * @retval HIGH (true)
+	 * @retval LOW (false)
+	 */
+	virtual bool getInptLvl(const uint8_t &inptId) = 0;
+	/**
+	 * @brief Returns the value of the **snpshtUpd** attribute flag.
+	 *
+	 * @retval true: the object's updSnpsht() method is executed every timer interrupt service.
+	 * @retval false: the object's updSnpsht() method is not executed by the timer interrupt service.
+	 */
+	bool getSnpshtUpd();
+	/**
+	 * @brief Sets the object to have (or not to have) its updSnpsht() method executed every timer interrupt service.
+	 *
+	 * @param newSnpshtUpd The new value for the **snpshtUpd** attribute flag.
+	 */
+	void setSnpshtUpd(const bool &newSnpshtUpd);
+	/**
+	 * @brief Updates the snapshot of the input signals levels kept by the object.
+	 *
+	 * The method is executed once every timer interrupt service -if the object is set to, see setSnpshtUpd(const bool)- before the DbncdMPBttn objects status is updated. The base class implementation does nothing, subclasses reading all the input signals at once must override it.
+	 */
+	virtual void updSnpsht();
+};
+
+//==========================================================>>
+
+/**
+ * @brief Abstract class, base to model objects to be notified of the **isOn** attribute flag changes of DbncdMPBttn class and subclasses objects.
+ *
+ * The notifications are generated by the MPBs set to use the listener -see DbncdMPBttn::addSttLstnr(MpbSttLstnr*)- from inside their state update, so from inside the timer interrupt service.
+ *
+ * @attention The notification methods implementation must be kept short and fast, and must not use blocking or interrupt dependent resources, as they are executed from inside the timer interrupt service.
+ *
+ * @class MpbSttLstnr
+ */
+class MpbSttLstnr{
+public:
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~MpbSttLstnr();
+	/**
+	 * @brief Notifies the listener of a MPB **isOn** attribute flag change from true to false.
+	 *
+	 * @param mpbPtr Pointer to the MPB that turned Off.
+	 */
+	virtual void mpbTrndOff(DbncdMPBttn* mpbPtr) = 0;
+	/**
+	 * @brief Notifies the listener of a MPB **isOn** attribute flag change from false to true.
+	 *
+	 * @param mpbPtr Pointer to the MPB that turned On.
+	 */
+	virtual void mpbTrndOn(DbncdMPBttn* mpbPtr) = 0;
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a bank (group) of DbncdMPBttn class and subclasses objects, to apply status changes to all of it's members at once.
+ *
+ * Pausing or resuming objects one by one makes the timer period to be recalculated, and the timer to be reprogrammed, for every object. The bank applies the pause(), resume(), enable(), disable() and clrStatus(bool) methods to all it's members in one pass, recalculating and reprogramming the timer period **once** per bank method invocation. Useful to disable or pause complete machine sections, control panels, etc.
+ *
+ * @note The objects are not owned by the bank, an object might be a member of several banks, and it's lifetime is not affected by the bank's.
+ *
+ * @class MpbBnk
+ */
+class MpbBnk{
+protected:
+	DbncdMPBttn** _mbrsLstPtr{nullptr};
+
+public:
+	/**
+	 * @brief Default constructor
+	 */
+	MpbBnk();
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param mbrsArr Pointer to an array of pointers to the objects to be included in the bank.
+	 * @param mbrsQty Number of elements in the array.
+	 */
+	MpbBnk(DbncdMPBttn** mbrsArr, const uint8_t &mbrsQty);
+	/**
+	 * @brief Copy constructor deleted, the object owns the members list.
+	 */
+	MpbBnk(const MpbBnk&) = delete;
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~MpbBnk();
+	/**
+	 * @brief Copy assignment operator deleted, see MpbBnk(const MpbBnk&)
+	 */
+	MpbBnk& operator=(const MpbBnk&) = delete;
+	/**
+	 * @brief Adds an object to the bank.
+	 *
+	 * @param mpb Pointer to the object to be added.
+	 *
+	 * @retval true: the object was added, or was already a member of the bank.
+	 * @retval false: the pointer was nullptr.
+	 */
+	bool addMpb(DbncdMPBttn* mpb);
+	/**
+	 * @brief Applies the DbncdMPBttn::clrStatus(bool) method to all the bank members.
+	 *
+	 * @param clrIsOn See DbncdMPBttn::clrStatus(bool)
+	 *
+	 * @note The method is virtual, so each member's class implementation is the one executed, clearing the latched, timed, voided, etc. states specific to it.
+	 */
+	void clrStatus(bool clrIsOn = true);
+	/**
+	 * @brief Applies the DbncdMPBttn::disable() method to all the bank members.
+	 */
+	void disable();
+	/**
+	 * @brief Applies the DbncdMPBttn::enable() method to all the bank members.
+	 */
+	void enable();
+	/**
+	 * @brief Returns the number of objects in the bank.
+	 *
+	 * @return The number of members of the bank.
+	 */
+	uint8_t getMbrsQty();
+	/**
+	 * @brief Pauses the status update of all the bank members, recalculating the update timer period once.
+	 *
+	 * See DbncdMPBttn::pause()
+	 *
+	 * @retval true: all the bank members were paused.
+	 * @retval false: one or more bank members were not in the "list of MPBs to keep updated", so they couldn't be paused.
+	 */
+	bool pause();
+	/**
+	 * @brief Resumes the status update of all the bank members, recalculating the update timer period once.
+	 *
+	 * See DbncdMPBttn::resume()
+	 *
+	 * @retval true: all the bank members were resumed.
+	 * @retval false: one or more bank members were not in the "list of MPBs to keep updated", or had no valid poll period, so they couldn't be resumed.
+	 */
+	bool resume();
+	/**
+	 * @brief Removes an object from the bank.
+	 *
+	 * @param mpb Pointer to the object to be removed.
+	 *
+	 * @retval true: the object was removed.
+	 * @retval false: the object was not a member of the bank.
+	 */
+	bool rmvMpb(DbncdMPBttn* mpb);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a radio buttons group: a group of LtchMPBttn subclasses objects where only one member might be latched at a time.
+ *
+ * When a member of the group latches, the previously latched member -the active member- is unlatched through it's LtchMPBttn::unlatch() method, so the unlatching follows the regular latched MPB state machine, and the new member becomes the active member. The group is notified by the members from inside their state update -see MpbSttLstnr-, so the selection switch takes place in the same timer interrupt service the new member latched, with no need to poll all the members from the loop, and without considering the number of members of the group.
+ *
+ * The group is added to the state listeners of the members when they are added to the group, keeping any other state listener they might have, see DbncdMPBttn::addSttLstnr(MpbSttLstnr*).
+ *
+ * @note The unlatched member will turn Off when it's own state update takes place, in the same timer interrupt service or the next one, depending on the members updating order.
+ * @note A member turns On when pressed, but latches only when released. If a member turns On while the active member is still pressed, the active member keeps the unlatch pending and turns Off as soon as it's released, so both members are On until that release.
+ * @note The DblActnLtchMPBttn subclasses objects never latch, so they can't be group members, see LtchMPBttn::getUnltchSpprtd().
+ *
+ * @class MpbRdGrp
+ */
+class MpbRdGrp: public MpbSttLstnr{
+protected:
+	LtchMPBttn* volatile _actvMbr{nullptr};
+	DbncdMPBttn** _mbrsLstPtr{nullptr};
+
+public:
+	/**
+	 * @brief Default constructor
+	 */
+	MpbRdGrp();
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param mbrsArr Pointer to an array of pointers to the objects to be included in the group.
+	 * @param mbrsQty Number of elements in the array.
+	 */
+	MpbRdGrp(LtchMPBttn** mbrsArr, const uint8_t &mbrsQty);
+	/**
+	 * @brief Copy constructor deleted, the object owns the members list and is set as the members state listener.
+	 */
+	MpbRdGrp(const MpbRdGrp&) = delete;
+	/**
+	 * @brief Class virtual destructor
+	 *
+	 * The group is removed from the state listeners of it's members.
+	 */
+	virtual ~MpbRdGrp();
+	/**
+	 * @brief Copy assignment operator deleted, see MpbRdGrp(const MpbRdGrp&)
+	 */
+	MpbRdGrp& operator=(const MpbRdGrp&) = delete;
+	/**
+	 * @brief Adds an object to the group.
+	 *
+	 * If the object added is latched and the group has an active member, the added object is unlatched. If the group has no active member, the added latched object becomes the active member.
+	 *
+	 * @param mpb Pointer to the object to be added.
+	 *
+	 * @retval true: the object was added, or was already a member of the group.
+	 * @retval false: the pointer was nullptr, the object never latches -see LtchMPBttn::getUnltchSpprtd()-, or the object has all it's state listener slots taken by other listeners -see DbncdMPBttn::addSttLstnr(MpbSttLstnr*)-, the object was not added.
+	 */
+	bool addMpb(LtchMPBttn* mpb);
+	/**
+	 * @brief Unlatches the active member of the group, leaving the group with no member latched.
+	 *
+	 * @retval true: the group had an active member, and it was unlatched. If the active member is still pressed it will turn Off when released, see LtchMPBttn::unlatch().
+	 * @retval false: the group had no active member.
+	 */
+	bool clrSlctn();
+	/**
+	 * @brief Returns a pointer to the active member of the group.
+	 *
+	 * @return Pointer to the active member.
+	 * @retval nullptr: the group has no active member.
+	 */
+	LtchMPBttn* getActvMbr();
+	/**
+	 * @brief Returns the index of the active member of the group.
+	 *
+	 * The index is the position of the member in the group, in the order the members were added.
+	 *
+	 * @return The index of the active member.
+	 * @retval 0xFF: the group has no active member.
+	 */
+	uint8_t getActvMbrIdx();
+	/**
+	 * @brief Returns the number of objects in the group.
+	 *
+	 * @return The number of members of the group.
+	 */
+	uint8_t getMbrsQty();
+	/**
+	 * @brief See MpbSttLstnr::mpbTrndOff(DbncdMPBttn*)
+	 */
+	virtual void mpbTrndOff(DbncdMPBttn* mpbPtr);
+	/**
+	 * @brief See MpbSttLstnr::mpbTrndOn(DbncdMPBttn*)
+	 */
+	virtual void mpbTrndOn(DbncdMPBttn* mpbPtr);
+	/**
+	 * @brief Removes an object from the group.
+	 *
+	 * The group is removed from the state listeners of the object. It's state is not modified.
+	 *
+	 * @param mpb Pointer to the object to be removed.
+	 *
+	 * @retval true: the object was removed.
+	 * @retval false: the object was not a member of the group.
+	 */
+	bool rmvMpb(LtchMPBttn* mpb);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a chords and sequences detector, recognizing configured combinations of DbncdMPBttn class and subclasses objects (the members) turning On, each one with it's time window constraint.
+ *
+ * Each combination to recognize is a **pattern** of one of two kinds:
+ * - **Chord**: a set of members that must be On at the same time, the last member of the set turning On inside a time window measured from the turning On of the first. The chord pattern is kept On while all the members of the set are kept On, turning Off when any of them turns Off.
+ * - **Sequence**: an ordered list of members that must turn On one after the other, each one inside a time window measured from the turning On of the previous. The sequence pattern is kept On while the last member of the sequence is kept On, turning Off when it turns Off. Any other member of the detector turning On resets the sequence progress.
+ *
+ * The detector is notified by the members from inside their state update -see MpbSttLstnr-, so the patterns are matched incrementally, only when a member changes state, with no periodic scanning of the members. The recognized patterns are exposed as switch-like outputs: each one has it's isOn and outputsChange attribute flags, and the functions to be executed when it turns On or Off.
+ *
+ * The detector is added to the state listeners of the members at instantiation, keeping any other state listener they might have, see DbncdMPBttn::addSttLstnr(MpbSttLstnr*). A member with all it's state listener slots already taken can't notify the detector, the condition is reported by the getMbrsLnkd() method.
+ *
+ * @note The members are identified in the patterns by their index in the members array provided to the constructor, up to 16 members are accepted.
+ * @note A chord pattern doesn't check other members state: a chord pattern might be recognized while recognizing a bigger chord pattern including it's members.
+ *
+ * @class MpbChrdDtctr
+ */
+class MpbChrdDtctr: public MpbSttLstnr{
+protected:
+	struct chrdPtrn_t{
+		uint16_t mbrsMsk;
+		uint8_t* sqncArr;
+		uint8_t sqncLen;
+		uint8_t sqncStp;
+		unsigned long int sqncLstTm;
+		unsigned long int wndwMs;
+		fncPtrType fnWhnTrnOff;
+		fncPtrType fnWhnTrnOn;
+		volatile bool isOn;
+		volatile bool outputsChange;
+	};
+
+	volatile uint16_t _mbrsOnMsk{0};
+	DbncdMPBttn** _mbrsArr{nullptr};
+	unsigned long int* _mbrsOnTmArr{nullptr};
+	bool _mbrsLnkd{true};
+	uint8_t _mbrsQty{0};
+	chrdPtrn_t* _ptrnsArr{nullptr};
+	uint8_t _ptrnsMax{0};
+	volatile uint8_t _ptrnsQty{0};
+
+	uint8_t _addPtrn(const uint16_t &mbrsMsk, uint8_t* sqncArr, const uint8_t &sqncLen, const unsigned long int &wndwMs);
+	uint8_t _getMbrIdx(DbncdMPBttn* mpbPtr);
+	void _turnOffPtrn(chrdPtrn_t &ptrn);
+	void _turnOnPtrn(chrdPtrn_t &ptrn);
+
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param mbrsArr Pointer to an array of pointers to the objects to be the members of the detector.
+	 * @param mbrsQty Number of elements in the array, up to 16.
+	 * @param ptrnsMax Maximum number of patterns to be configured.
+	 *
+	 * @note If more than 16 members are provided, only the first 16 are accepted.
+	 */
+	MpbChrdDtctr(DbncdMPBttn** mbrsArr, const uint8_t &mbrsQty, const uint8_t &ptrnsMax);
+	/**
+	 * @brief Copy constructor deleted, the object owns the members and patterns arrays and is set as the members state listener.
+	 */
+	MpbChrdDtctr(const MpbChrdDtctr&) = delete;
+	/**
+	 * @brief Class virtual destructor
+	 *
+	 * The detector is removed from the state listeners of it's members.
+	 */
+	virtual ~MpbChrdDtctr();
+	/**
+	 * @brief Copy assignment operator deleted, see MpbChrdDtctr(const MpbChrdDtctr&)
+	 */
+	MpbChrdDtctr& operator=(const MpbChrdDtctr&) = delete;
+	/**
+	 * @brief Adds a chord pattern to the detector.
+	 *
+	 * @param mbrsMsk Bit mask of the members of the chord, bit 0 corresponding to the member with index 0, bit 1 to the member with index 1, and so on.
+	 * @param wndwMs Time window in milliseconds, measured from the first member of the chord turning On, for the last member of the chord to turn On.
+	 *
+	 * @return The pattern id, to be used as parameter by the patterns related methods.
+	 * @retval 0xFF: the pattern couldn't be added, the mask was 0 or included non existent members, or the maximum number of patterns was reached.
+	 */
+	uint8_t addChrd(const uint16_t &mbrsMsk, const unsigned long int &wndwMs);
+	/**
+	 * @brief Adds a sequence pattern to the detector.
+	 *
+	 * @param mbrsIdxArr Pointer to an array holding the members indexes in the order they must turn On. The array contents is copied, so it doesn't need to be kept after the method is executed.
+	 * @param sqncLen Number of elements in the array, at least 1.
+	 * @param wndwMs Time window in milliseconds, measured from a member of the sequence turning On, for the next member of the sequence to turn On.
+	 *
+	 * @return The pattern id, to be used as parameter by the patterns related methods.
+	 * @retval 0xFF: the pattern couldn't be added, the sequence was empty or included non existent members, or the maximum number of patterns was reached.
+	 */
+	uint8_t addSqnc(const uint8_t* mbrsIdxArr, const uint8_t &sqncLen, const unsigned long int &wndwMs);
+	/**
+	 * @brief Returns the value of the pattern's **isOn** attribute flag.
+	 *
+	 * @param ptrnId The pattern id, as returned by addChrd(const uint16_t, const unsigned long int) or addSqnc(const uint8_t*, const uint8_t, const unsigned long int).
+	 *
+	 * @retval true: The pattern is recognized, and kept On.
+	 * @retval false: The pattern is not recognized, or the ptrnId is not valid.
+	 */
+	bool getIsOn(const uint8_t &ptrnId);
+	/**
+	 * @brief Returns the value of the **mbrsLnkd** attribute flag.
+	 *
+	 * The flag reports if every member accepted the detector as a state listener when it was instantiated, see DbncdMPBttn::addSttLstnr(MpbSttLstnr*).
+	 *
+	 * @retval true: all the members notify their state changes to the detector.
+	 * @retval false: at least one member had all it's state listener slots taken, the patterns including it will never be recognized.
+	 */
+	bool getMbrsLnkd();
+	/**
+	 * @brief Returns the value of the pattern's **outputsChange** attribute flag.
+	 *
+	 * The flag is set when the pattern's **isOn** attribute flag changes value, and must be reset through the setOutputsChange(const uint8_t, bool) method after the outputs processing code is executed.
+	 *
+	 * @param ptrnId The pattern id.
+	 *
+	 * @retval true: The pattern's **isOn** attribute flag changed since the last reset of the flag.
+	 * @retval false: The pattern's **isOn** attribute flag didn't change, or the ptrnId is not valid.
+	 */
+	bool getOutputsChange(const uint8_t &ptrnId);
+	/**
+	 * @brief Returns the number of patterns configured.
+	 *
+	 * @return The number of patterns added to the detector.
+	 */
+	uint8_t getPtrnsQty();
+	/**
+	 * @brief See MpbSttLstnr::mpbTrndOff(DbncdMPBttn*)
+	 */
+	virtual void mpbTrndOff(DbncdMPBttn* mpbPtr);
+	/**
+	 * @brief See MpbSttLstnr::mpbTrndOn(DbncdMPBttn*)
+	 */
+	virtual void mpbTrndOn(DbncdMPBttn* mpbPtr);
+	/**
+	 * @brief Sets the function to be executed when the pattern's **isOn** attribute flag changes from true to false.
+	 *
+	 * @param ptrnId The pattern id.
+	 * @param newFnWhnTrnOff Pointer to the function to be executed, or **nullptr** to execute no function.
+	 *
+	 * @attention The function is executed from inside the timer interrupt service, see MpbSttLstnr.
+	 */
+	void setFnWhnTrnOffPtr(const uint8_t &ptrnId, void (*newFnWhnTrnOff)());
+	/**
+	 * @brief Sets the function to be executed when the pattern's **isOn** attribute flag changes from false to true.
+	 *
+	 * @param ptrnId The pattern id.
+	 * @param newFnWhnTrnOn Pointer to the function to be executed, or **nullptr** to execute no function.
+	 *
+	 * @attention The function is executed from inside the timer interrupt service, see MpbSttLstnr.
+	 */
+	void setFnWhnTrnOnPtr(const uint8_t &ptrnId, void (*newFnWhnTrnOn)());
+	/**
+	 * @brief Sets the value of the pattern's **outputsChange** attribute flag.
+	 *
+	 * @param ptrnId The pattern id.
+	 * @param newOutputsChange The new value for the flag.
+	 */
+	void setOutputsChange(const uint8_t &ptrnId, bool newOutputsChange);
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a persistence layer keeping the state of a set of DbncdMPBttn class and subclasses objects (the members) in the EEPROM, to be restored after a power loss.
+ *
+ * The state saved for each member is the **isOn** attribute flag -restored as a latched On state by the latching subclasses-, the **isVoided** attribute flag -restored by the voidable subclasses- and the **otptCurVal** register -restored by the SldrDALtchMPBttn class-. The momentary DbncdMPBttn and DbncdDlydMPBttn classes objects don't restore any state.
+ *
+ * The EEPROM area assigned is used as a **wear leveled ring** of records, each one holding the state of all the members, a sequence number and a CRC-8 checksum. Each new record is written in the position following the last one, so the writes are spread over the whole area, and the checksum lets the restore discard a record partially written when the power was lost.
+ * The writes are **coalesced**: the members state is checked by the updPrstnc() method, and a new record is written only after the state has been kept unchanged for the **stability time**, so a long slider ramp or a burst of presses costs a single record write. The record is written one byte per updPrstnc() invocation, and only when the EEPROM is ready to accept it, so the method never waits for the EEPROM write cycle to end.
+ *
+ * The EEPROM is accessed through the avr-libc functions in the AVR platforms, and through the EEPROM library when it's available to the build (the sketch includes <EEPROM.h>) in other platforms. If none of them is available the records are not written nor read.
+ *
+ * @note The records layout depends on the members quantity, changing the quantity invalidates the records saved, as does changing the EEPROM area assigned.
+ * @note The EEPROM library of some platforms (i.e. ESP8266, ESP32, RP2040) emulates the EEPROM in a RAM buffer saved to flash memory: the begin() method sizes the buffer to the end of the area assigned with EEPROM.begin(), and every complete record written is saved with EEPROM.commit(). When several objects are used the one with the highest area end address must be the last to execute it's begin() method.
+ *
+ * @class MpbPrstnc
+ */
+class MpbPrstnc{
+protected:
+	uint8_t* _cnddtBffr{nullptr};
+	bool _cnddtPndng{false};
+	unsigned long int _cnddtTm{0};
+	uint16_t _eeStrtAddr{0};
+	DbncdMPBttn** _mbrsArr{nullptr};
+	uint8_t _mbrsQty{0};
+	uint8_t _nxtRcrdIdx{0};
+	uint8_t _nxtRcrdSeq{0};
+	uint8_t* _rcrdBffr{nullptr};
+	uint8_t _rcrdSz{0};
+	uint8_t _rcrdsQty{0};
+	unsigned long int _stblTm{2000};
+	uint8_t _wrtIdx{0};
+
+	uint8_t _calcRcrdCrc(const uint8_t* rcrdPtr);
+	static uint8_t _eeRd(const uint16_t &addr);
+	static bool _eeRdy();
+	static void _eeWrt(const uint16_t &addr, const uint8_t &val);
+	bool _rdRcrd(const uint8_t &rcrdIdx);
+	bool _takeSnpsht(uint8_t* bffrPtr);
+
+public:
+	/**
+	 * @brief Default constructor
+	 */
+	MpbPrstnc();
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param mbrsArr Pointer to an array of pointers to the objects to be the members of the persistence layer. The order of the members defines the records layout, and must be kept between the application builds for the restore to be done to the right objects.
+	 * @param mbrsQty Number of elements in the array, up to 84.
+	 * @param eeStrtAddr First EEPROM address of the area assigned to the records ring.
+	 * @param eeSz Size in bytes of the area assigned to the records ring. Each record takes (2 + 3 * mbrsQty) bytes, and up to 254 records are used, the bigger the area, the lower the wear of each EEPROM cell.
+	 * @param stblTm (Optional) Stability time in milliseconds, see setStblTm(const unsigned long int).
+	 *
+	 * @note If more than 84 members are provided, only the first 84 are accepted.
+	 */
+	MpbPrstnc(DbncdMPBttn** mbrsArr, const uint8_t &mbrsQty, const uint16_t &eeStrtAddr, const uint16_t &eeSz, const unsigned long int &stblTm = 2000);
+	/**
+	 * @brief Copy constructor deleted, the object owns the members array and the records buffers.
+	 */
+	MpbPrstnc(const MpbPrstnc&) = delete;
+	/**
+	 * @brief Class destructor
+	 */
+	~MpbPrstnc();
+	/**
+	 * @brief Copy assignment operator deleted, see MpbPrstnc(const MpbPrstnc&)
+	 */
+	MpbPrstnc& operator=(const MpbPrstnc&) = delete;
+	/**
+	 * @brief Restores the members state from the last valid record of the ring
+	 *
+	 * The ring is scanned for the last record written: the record passing the checksum verification that is not followed by a valid record holding the next sequence number. Slots failing the verification -erased, partially written when the power was lost, or holding data not written by the object- are never taken as the ring position. The state saved in that record is restored to each member, and the next record will be written in the following slot. If no valid record is found the ring is restarted from it's first slot.
+	 * The method can be invoked before or after the members begin() method, the members attached to the timer interrupt service are detached while their state is restored.
+	 *
+	 * @return The success in restoring the state.
+	 * @retval true A valid record was found and it's state restored to the members.
+	 * @retval false No valid record was found (i.e. the first run of the application or the records layout was changed), the members state is not changed.
+	 *
+	 * @note The states restored are set as any other state change: the functions set to be executed when the members turn On (or are voided) are executed, and the **outputsChange** attribute flag of the members is set.
+	 * @warning The method must be invoked before the first updPrstnc() invocation, as it sets the ring position for the next record to be written.
+	 */
+	bool begin();
+	/**
+	 * @brief Returns the stability time setting
+	 *
+	 * @return The stability time in milliseconds.
+	 */
+	unsigned long int getStblTm();
+	/**
+	 * @brief Returns a value indicating if the members state has changed and is not yet saved in the EEPROM
+	 *
+	 * @return The pending write state.
+	 * @retval true The members state changed and the stability time is running, or a record is being written.
+	 * @retval false The EEPROM holds the current state of the members.
+	 */
+	bool getWrtPndng();
+	/**
+	 * @brief Sets the stability time
+	 *
+	 * The stability time is the time the members state must be kept unchanged before it's saved in a new record.
+	 *
+	 * @param newStblTm The new stability time in milliseconds.
+	 */
+	void setStblTm(const unsigned long int &newStblTm);
+	/**
+	 * @brief Checks the members state and writes the pending record to the EEPROM
+	 *
+	 * The method must be invoked periodically from the application's main loop. When no record is being written the members state is compared to the last one taken, restarting the stability time count if it changed, and starting the writing of a new record if it's kept unchanged for the stability time and differs from the last saved. When a record is being written the method writes it's next byte if the EEPROM is ready to accept it.
+	 *
+	 * @attention The method is not to be invoked from an interrupt service.
+	 */
+	void updPrstnc();
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a bank of input signals read through a chain of 74HC165 (parallel in, serial out) shift registers.
+ *
+ * The whole chain is read **once** every timer interrupt service, keeping a snapshot of all the input levels, and each input level is provided to the DbncdMPBttn class and subclasses objects set to use the bank as their input provider -see DbncdMPBttn::setInptPrvdr(MpbInptPrvdr*)-. The **mpbttnPin** attribute of each object is used as the input index in the chain: the first shift register read (the one whose serial output is connected to the mcu) holds the inputs 0 to 7 (input 0 being the **A** parallel input, input 7 being the **H** parallel input), the next one in the chain holds the inputs 8 to 15, and so on.
+ *
+ * The chain might be read by "bit banging" three GPIO pins, or by the hardware SPI peripheral. The hardware SPI is used by the objects built by the ShftRgstrInptBnk(const uint8_t, const uint8_t) constructor when the SPI library is available to the build (the sketch includes <SPI.h>), otherwise the standard SPI pins are used by "bit banging".
+ *
+ * @attention When the hardware SPI is used the bus is accessed from inside the timer interrupt service, so the begin() method registers that use with SPI.usingInterrupt(): every SPI transaction started by the rest of the code (SD cards, displays, etc.) will disable the interrupts until it's ended, so it can't be corrupted by the chain reading. Devices sharing the bus must use the SPI transactions API.
+ *
+ * @note As every input reading replaces a GPIO pin reading, the usual **pulledUp** and **typeNO** attributes of each object will apply to the input level read, so when the parallel inputs use pull-up resistors the default values of the DbncdMPBttn constructor are to be used.
+ *
+ * @class ShftRgstrInptBnk
+ */
+class ShftRgstrInptBnk: public MpbInptPrvdr{
+protected:
+	uint8_t _chipsQty{0};
+	uint8_t _clkPin{_InvalidPinNum};
+	volatile uint8_t* _clkPortReg{nullptr};
+	uint8_t _clkPinMsk{0};
+	uint8_t _dataPin{_InvalidPinNum};
+	volatile uint8_t* _dataPortReg{nullptr};
+	uint8_t _dataPinMsk{0};
+	uint8_t* _inptsSnpsht{nullptr};
+	uint8_t _ldPin{_InvalidPinNum};
+	volatile uint8_t* _ldPortReg{nullptr};
+	uint8_t _ldPinMsk{0};
+	bool _useHwSpi{false};
+
+	uint8_t _rdByte();
+
+public:
+	/**
+	 * @brief Class constructor for a chain read by "bit banging" GPIO pins.
+	 *
+	 * @param ldPin Pin connected to the parallel load (/PL, a.k.a. SH/LD) input of all the shift registers of the chain.
+	 * @param clkPin Pin connected to the clock (CP) input of all the shift registers of the chain.
+	 * @param dataPin Pin connected to the serial output (Q7, a.k.a. QH) of the first shift register of the chain.
+	 * @param chipsQty Number of shift registers in the chain, each one provides 8 inputs.
+	 */
+	ShftRgstrInptBnk(const uint8_t &ldPin, const uint8_t &clkPin, const uint8_t &dataPin, const uint8_t &chipsQty);
+	/**
+	 * @brief Class constructor for a chain read by the hardware SPI peripheral.
+	 *
+	 * The clock input of the chain must be connected to the SCK pin, and the serial output of the first shift register to the MISO pin. If the SPI library is not available to the build those same pins will be used by "bit banging".
+	 *
+	 * @param ldPin Pin connected to the parallel load (/PL, a.k.a. SH/LD) input of all the shift registers of the chain.
+	 * @param chipsQty Number of shift registers in the chain, each one provides 8 inputs.
+	 */
+	ShftRgstrInptBnk(const uint8_t &ldPin, const uint8_t &chipsQty);
+	/**
+	 * @brief Copy constructor deleted, the object owns the input levels snapshot buffer and might be linked in the list of providers updated by the timer interrupt service.
+	 */
+	ShftRgstrInptBnk(const ShftRgstrInptBnk&) = delete;
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~ShftRgstrInptBnk();
+	/**
+	 * @brief Copy assignment operator deleted, see ShftRgstrInptBnk(const ShftRgstrInptBnk&)
+	 */
+	ShftRgstrInptBnk& operator=(const ShftRgstrInptBnk&) = delete;
+	/**
+	 * @brief Configures the pins (and the SPI peripheral if used), reads the chain for the first time and registers the object to be read every timer interrupt service.
+	 *
+	 * @return A boolean indicating the success of the operation.
+	 * @retval true: the object was set to be read every timer interrupt service.
+	 * @retval false: the object parameters are not valid (no shift registers, or invalid pins), no change was made.
+	 *
+	 * @attention This method must be invoked before the begin() method of the DbncdMPBttn objects using the bank as input provider.
+	 */
+	bool begin();
+	/**
+	 * @brief Removes the object from the list of providers read every timer interrupt service.
+	 *
+	 * The last snapshot of the input levels is kept and will be provided to the objects using the bank.
+	 */
+	void end();
+	/**
+	 * @brief Returns the number of inputs provided by the chain.
+	 *
+	 * @return The number of inputs, 8 for every shift register in the chain.
+	 */
+	uint16_t getInptsQty();
+	/**
+	 * @brief See MpbInptPrvdr::getInptLvl(const uint8_t)
+	 *
+	 * @note For an input index beyond the chain length the method returns HIGH, that is the released level for the default pulled up, normally open settings.
+	 */
+	virtual bool getInptLvl(const uint8_t &inptId);
+	/**
+	 * @brief Reads the whole chain keeping a snapshot of the inputs levels.
+	 *
+	 * See MpbInptPrvdr::updSnpsht()
+	 */
+	virtual void updSnpsht();
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a bank of output signals written through a chain of 74HC595 (serial in, parallel out) shift registers.
+ *
+ * The bank keeps an image of all the chain outputs levels. The output attribute flags of the DbncdMPBttn class and subclasses objects bound to the bank outputs -see DbncdMPBttn::setOtptPin(const uint8_t, ShftRgstrOtptBnk*, const uint8_t, const bool)- modify the image when they change, and the whole chain is transferred **once** at the end of every timer interrupt service, after all the objects were updated, and only if any output level changed. The first shift register of the chain (the one whose serial input is connected to the mcu) holds the outputs 0 to 7 (output 0 being the **QA** parallel output, output 7 being the **QH** parallel output), the next one in the chain holds the outputs 8 to 15, and so on.
+ *
+ * The chain might be written by "bit banging" three GPIO pins, or by the hardware SPI peripheral. The hardware SPI is used by the objects built by the ShftRgstrOtptBnk(const uint8_t, const uint8_t) constructor when the SPI library is available to the build (the sketch includes <SPI.h>), otherwise the standard SPI pins are used by "bit banging".
+ *
+ * @attention When the hardware SPI is used the bus is accessed from inside the timer interrupt service, so the begin() method registers that use with SPI.usingInterrupt(): every SPI transaction started by the rest of the code (SD cards, displays, etc.) will disable the interrupts until it's ended, so it can't be corrupted by the chain writing. Devices sharing the bus must use the SPI transactions API.
+ *
+ * @note The outputs not bound to any object might be set by the setOtptLvl(const uint8_t, const bool) method, they will be transferred with the next chain writing.
+ *
+ * @class ShftRgstrOtptBnk
+ */
+class ShftRgstrOtptBnk{
+	friend class DbncdMPBttn;
+
+	static ShftRgstrOtptBnk* _otptsUpdLstPtr;
+	static void _updOtptsBnks();
+
+	ShftRgstrOtptBnk* _nxtOtptsUpd{nullptr};
+	bool _otptsUpd{false};
+
+protected:
+	uint8_t _chipsQty{0};
+	uint8_t _clkPin{_InvalidPinNum};
+	volatile uint8_t* _clkPortReg{nullptr};
+	uint8_t _clkPinMsk{0};
+	uint8_t _dataPin{_InvalidPinNum};
+	volatile uint8_t* _dataPortReg{nullptr};
+	uint8_t _dataPinMsk{0};
+	uint8_t _ltchPin{_InvalidPinNum};
+	volatile uint8_t* _ltchPortReg{nullptr};
+	uint8_t _ltchPinMsk{0};
+	volatile bool _otptsChng{false};
+	uint8_t* _otptsImg{nullptr};
+	bool _useHwSpi{false};
+
+	void _setOtptImgLvl(const uint8_t &otptId, const bool &newLvl);
+	void _wrtByte(const uint8_t &otptByte);
+
+public:
+	/**
+	 * @brief Class constructor for a chain written by "bit banging" GPIO pins.
+	 *
+	 * @param ltchPin Pin connected to the storage register clock (STCP, a.k.a. RCLK or latch) input of all the shift registers of the chain.
+	 * @param clkPin Pin connected to the shift register clock (SHCP, a.k.a. SRCLK) input of all the shift registers of the chain.
+	 * @param dataPin Pin connected to the serial input (DS, a.k.a. SER) of the first shift register of the chain.
+	 * @param chipsQty Number of shift registers in the chain, each one provides 8 outputs.
+	 */
+	ShftRgstrOtptBnk(const uint8_t &ltchPin, const uint8_t &clkPin, const uint8_t &dataPin, const uint8_t &chipsQty);
+	/**
+	 * @brief Class constructor for a chain written by the hardware SPI peripheral.
+	 *
+	 * The shift register clock input of the chain must be connected to the SCK pin, and the serial input of the first shift register to the MOSI pin. If the SPI library is not available to the build those same pins will be used by "bit banging".
+	 *
+	 * @param ltchPin Pin connected to the storage register clock (STCP, a.k.a. RCLK or latch) input of all the shift registers of the chain.
+	 * @param chipsQty Number of shift registers in the chain, each one provides 8 outputs.
+	 */
+	ShftRgstrOtptBnk(const uint8_t &ltchPin, const uint8_t &chipsQty);
+	/**
+	 * @brief Copy constructor deleted, the object owns the outputs image buffer, might be bound to objects outputs and might be linked in the list of banks written by the timer interrupt service.
+	 */
+	ShftRgstrOtptBnk(const ShftRgstrOtptBnk&) = delete;
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~ShftRgstrOtptBnk();
+	/**
+	 * @brief Copy assignment operator deleted, see ShftRgstrOtptBnk(const ShftRgstrOtptBnk&)
+	 */
+	ShftRgstrOtptBnk& operator=(const ShftRgstrOtptBnk&) = delete;
+	/**
+	 * @brief Configures the pins (and the SPI peripheral if used), writes the outputs image to the chain for the first time and registers the object to be written every timer interrupt service.
+	 *
+	 * @return A boolean indicating the success of the operation.
+	 * @retval true: the object was set to be written every timer interrupt service.
+	 * @retval false: the object parameters are not valid (no shift registers, or invalid pins), no change was made.
+	 *
+	 * @note The outputs image is set to all outputs LOW when the object is built.
+	 */
+	bool begin();
+	/**
+	 * @brief Removes the object from the list of banks written every timer interrupt service.
+	 *
+	 * The outputs image keeps being updated, but it will not be transferred to the chain until the begin() method is invoked again.
+	 */
+	void end();
+	/**
+	 * @brief Returns the level of an output as kept in the outputs image.
+	 *
+	 * @param otptId Index of the output in the chain.
+	 *
+	 * @return The output level, LOW for an output index beyond the chain length.
+	 */
+	bool getOtptLvl(const uint8_t &otptId);
+	/**
+	 * @brief Returns the number of outputs provided by the chain.
+	 *
+	 * @return The number of outputs, 8 for every shift register in the chain.
+	 */
+	uint16_t getOtptsQty();
+	/**
+	 * @brief Sets the level of an output in the outputs image.
+	 *
+	 * The chain is not written by this method, the new level is transferred to the chain with all the other changes at the end of the next timer interrupt service.
+	 *
+	 * @param otptId Index of the output in the chain.
+	 * @param newLvl The new level for the output.
+	 *
+	 * @retval true the otptId parameter was within range, the level was set.
+	 * @retval false the otptId parameter was beyond the chain length, nothing was changed.
+	 */
+	bool setOtptLvl(const uint8_t &otptId, const bool &newLvl);
+	/**
+	 * @brief Writes the outputs image to the chain, if any output level changed since the last writing.
+	 *
+	 * The method is executed at the end of every timer interrupt service for the objects set by the begin() method, it might be invoked to write the chain with no wait when the timer interrupt service is not active.
+	 */
+	void updOtpts();
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a keypad matrix of up to 8 rows by 8 columns as a bank of input signals.
+ *
+ * The matrix is scanned **incrementally**, one row every timer interrupt service, to keep the interrupt service time bounded: at every timer interrupt the columns of the row driven in the previous one are read, and the next row is driven. When the last row is read the complete scan is verified for **ghosting** -three keys pressed in the corners of a rectangle make the fourth corner key look pressed-: the keys that might be ghosts, the ones in the intersections of the rows sharing two or more pressed columns with those shared columns, keep their last published levels, while the levels of the rest of the keys are published.
+ *
+ * The keys levels are kept compacted, one bit per key, and provided to the DbncdMPBttn class and subclasses objects set to use the keypad as their input provider -see DbncdMPBttn::setInptPrvdr(MpbInptPrvdr*)-, so each key needing a switch behavior (toggle, timed, voidable, etc.) is bound to an object of the needed class. The **mpbttnPin** attribute of each object is used as the key index: (row * columns quantity) + column, zero based. Those keys might be read by the getKyPrssd(const uint8_t) method, which provides a simple debounced level: a key level change is accepted when two consecutive complete scans agree.
+ *
+ * The row pins are driven LOW one at a time, and kept as high impedance inputs when not driven. The column pins are configured as INPUT_PULLUP, so a pressed key reads as LOW level, corresponding to the default **pulledUp** and **typeNO** attributes values of the DbncdMPBttn objects.
+ *
+ * @note Being each row read every **rowsQty** timer interrupts, the poll period of the objects using the keypad and the debounce times set should be selected considering the complete scan time.
+ * @note The switch behaviors are not kept compacted: each key bound to an object costs a complete object of it's class, the same as a MPB read from a GPIO pin. Only the keys with no object bound, read through getKyPrssd(const uint8_t), cost one bit.
+ *
+ * @class KpdMtrxInptBnk
+ */
+class KpdMtrxInptBnk: public MpbInptPrvdr{
+protected:
+	uint8_t* _colPins{nullptr};
+	uint8_t _colsQty{0};
+	uint8_t _curRow{0};
+	bool _ghstDtctd{false};
+	uint8_t* _kysLvl{nullptr};
+	uint8_t* _kysPrssd{nullptr};
+	uint8_t* _rowPins{nullptr};
+	uint8_t _rowsQty{0};
+	uint8_t* _scnRows{nullptr};
+
+	bool _chkGhstng(uint8_t &ghstRows, uint8_t &ghstCols);
+
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param rowPins Pointer to an array holding the pins connected to the keypad rows.
+	 * @param rowsQty Number of rows of the keypad, valid range is 1 to 8.
+	 * @param colPins Pointer to an array holding the pins connected to the keypad columns.
+	 * @param colsQty Number of columns of the keypad, valid range is 1 to 8.
+	 *
+	 * @note The pins arrays contents are copied, the arrays are not needed after the object is built.
+	 */
+	KpdMtrxInptBnk(const uint8_t* rowPins, const uint8_t &rowsQty, const uint8_t* colPins, const uint8_t &colsQty);
+	/**
+	 * @brief Copy constructor deleted, the object owns the pins and keys levels buffers and might be linked in the list of providers updated by the timer interrupt service.
+	 */
+	KpdMtrxInptBnk(const KpdMtrxInptBnk&) = delete;
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~KpdMtrxInptBnk();
+	/**
+	 * @brief Copy assignment operator deleted, see KpdMtrxInptBnk(const KpdMtrxInptBnk&)
+	 */
+	KpdMtrxInptBnk& operator=(const KpdMtrxInptBnk&) = delete;
+	/**
+	 * @brief Configures the pins, drives the first row and registers the object to be scanned every timer interrupt service.
+	 *
+	 * @return A boolean indicating the success of the operation.
+	 * @retval true: the object was set to be scanned every timer interrupt service.
+	 * @retval false: the object parameters are not valid, no change was made.
+	 */
+	bool begin();
+	/**
+	 * @brief Removes the object from the list of providers scanned every timer interrupt service, and releases the driven row.
+	 *
+	 * The last published keys levels are kept and will be provided to the objects using the keypad.
+	 */
+	void end();
+	/**
+	 * @brief Returns the ghosting detection attribute flag value.
+	 *
+	 * @retval true: the last complete scan had a ghosting risk, the levels of the keys that might be ghosts were not published.
+	 * @retval false: the last complete scan was completely published.
+	 */
+	bool getGhstDtctd();
+	/**
+	 * @brief See MpbInptPrvdr::getInptLvl(const uint8_t)
+	 *
+	 * @note For a key index beyond the keypad size the method returns HIGH, the level of a released key.
+	 */
+	virtual bool getInptLvl(const uint8_t &inptId);
+	/**
+	 * @brief Returns the debounced pressed state of a key.
+	 *
+	 * @param kyId Key index: (row * columns quantity) + column, zero based.
+	 *
+	 * @retval true: the key is pressed.
+	 * @retval false: the key is not pressed, or the key index is beyond the keypad size.
+	 */
+	bool getKyPrssd(const uint8_t &kyId);
+	/**
+	 * @brief Returns the number of keys of the keypad.
+	 *
+	 * @return The number of keys (rows quantity * columns quantity).
+	 */
+	uint8_t getKysQty();
+	/**
+	 * @brief Reads the driven row and drives the next one, publishing the keys levels after the last row is read.
+	 *
+	 * See MpbInptPrvdr::updSnpsht()
+	 */
+	virtual void updSnpsht();
+};
+
+//==========================================================>>
+
+/**
+ * @brief Models a bank of push buttons connected to a single analog input pin through a resistor ladder.
+ *
+ * Each push button pressed produces a different voltage level in the analog input pin, and the bank classifies the converted value into a button index by using **calibrated windows**, one (minimum, maximum) pair of converted values for each button. A converted value out of every window is considered as "no button pressed".
+ *
+ * One analog to digital conversion is done every timer interrupt service, **without waiting** for the conversion to complete: in the AVR architecture the conversion result is read, and the next conversion started, at each timer interrupt service, so the conversion time overlaps with the rest of the interrupt service and the main code execution. For other architectures the standard analogRead() is used.
+ *
+ * Each button level is provided to the DbncdMPBttn class and subclasses object set to use the bank as input provider -see DbncdMPBttn::setInptPrvdr(MpbInptPrvdr*)-, being the **mpbttnPin** attribute of the object used as the button index. A pressed button reads as LOW level, corresponding to the default **pulledUp** and **typeNO** attributes values of the DbncdMPBttn objects.
+ *
+ * @note A resistor ladder can't represent two buttons pressed at the same time, the button pressed that produces the closer voltage level to the "no button pressed" level is usually the one detected.
+ *
+ * Several banks might be active at the same time, each one connected to it's own analog input pin: the converter is then shared in a round robin fashion, each bank getting one conversion done in turns, so the conversions rate of each bank is divided by the number of active banks.
+ *
+ * @warning The analog to digital converter must not be used by other code while a bank is active. In the AVR architecture a conversion result is discarded if the converter channel selection was modified by other code, but the conversion started by the bank will be lost for that other code.
+ *
+ * @class AnlgLddrInptBnk
+ */
+class AnlgLddrInptBnk: public MpbInptPrvdr{
+	static AnlgLddrInptBnk* _adcOwnrPtr;
+	static uint8_t _actvBnksQty;
+
+	bool _bnkActv{false};
+
+protected:
+	uint16_t _adcVal{0};
+	uint8_t _admuxVal{0};
+	uint8_t _adcsrbVal{0};
+	uint8_t _anlgPin{_InvalidPinNum};
+	uint8_t _bttnsQty{0};
+	bool _cnvrsnStrtd{false};
+	uint8_t _curBttnId{0xFF};
+	uint16_t* _wndws{nullptr};
+
+	void _clssfyVal();
+
+public:
+	/**
+	 * @brief Class constructor
+	 *
+	 * @param anlgPin Analog input pin connected to the resistor ladder.
+	 * @param wndwsArr Pointer to an array of (2 * bttnsQty) converted values, holding the minimum and the maximum converted values for each button: {btn0Min, btn0Max, btn1Min, btn1Max, ...}
+	 * @param bttnsQty Number of buttons in the resistor ladder.
+	 *
+	 * @note The windows array contents are copied, the array is not needed after the object is built.
+	 */
+	AnlgLddrInptBnk(const uint8_t &anlgPin, const uint16_t* wndwsArr, const uint8_t &bttnsQty);
+	/**
+	 * @brief Copy constructor deleted, the object owns the calibrated windows buffer and might be linked in the list of providers updated by the timer interrupt service.
+	 */
+	AnlgLddrInptBnk(const AnlgLddrInptBnk&) = delete;
+	/**
+	 * @brief Class virtual destructor
+	 */
+	virtual ~AnlgLddrInptBnk();
+	/**
+	 * @brief Copy assignment operator deleted, see AnlgLddrInptBnk(const AnlgLddrInptBnk&)
+	 */
+	AnlgLddrInptBnk& operator=(const AnlgLddrInptBnk&) = delete;
+	/**
+	 * @brief Configures the analog to digital converter for the analog input pin and registers the object to be updated every timer interrupt service.
+	 *
+	 * @return A boolean indicating the success of the operation.
+	 * @retval true: the object was set to be updated every timer interrupt service.
+	 * @retval false: the object parameters are not valid, no change was made.
+	 *
+	 * @note The converter configuration is done by an initial analogRead() execution, so the analog reference set by the analogReference() function before this method is invoked is kept.
+	 */
+	bool begin();
+	/**
+	 * @brief Removes the object from the list of providers updated every timer interrupt service.
+	 *
+	 * If the bank was using the analog to digital converter it's released for the rest of the active banks.
+	 */
+	void end();
+	/**
+	 * @brief Returns the last converted value read.
+	 *
+	 * Provided for the windows calibration process.
+	 *
+	 * @return The last converted value.
+	 */
+	uint16_t getAdcVal();
+	/**
+	 * @brief Returns the index of the button detected as pressed by the last conversion.
+	 *
+	 * @return The index of the button pressed.
+	 * @retval 0xFF: no button pressed.
+	 */
+	uint8_t getCurBttnId();
+	/**
+	 * @brief See MpbInptPrvdr::getInptLvl(const uint8_t)
+	 */
+	virtual bool getInptLvl(const uint8_t &inptId);
+	/**
+	 * @brief Sets a button's calibrated window.
+	 *
+	 * @param bttnId Index of the button.
+	 * @param wndwMin Minimum converted value for the button.
+	 * @param wndwMax Maximum converted value for the button.
+	 *
+	 * @return A boolean indicating the success of the operation.
+	 * @retval true: the parameters were valid, the window was set.
+	 * @retval false: the button index was beyond the buttons quantity, or the minimum value was greater than the maximum value, no change was made.
+	 */
+	bool setWndw(const uint8_t &bttnId, const uint16_t &wndwMin, const uint16_t &wndwMax);
+	/**
+	 * @brief Reads the last conversion result, classifies it and starts the next conversion.
+	 *
+	 * When more than one bank is active the converter is handed to the next bank after each conversion is read, the banks not holding the converter keep their last classified value.
+	 *
+	 * See MpbInptPrvdr::updSnpsht()
+	 */
+	virtual void updSnpsht();
+};
+
+//==========================================================>>
+
 #endif   /*_BUTTONTOSWITCH_H_*/